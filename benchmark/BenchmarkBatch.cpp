@@ -0,0 +1,79 @@
+#include <cstddef> // size_t
+
+#include <chrono> // steady_clock, duration
+#include <iostream> // cout
+#include <vector> // vector
+#include <any> // any
+
+#include <Eightrefl/Core.hpp>
+
+struct BenchmarkBody
+{
+    float Position = 0.f;
+    float Velocity = 1.f;
+
+    void Update(float delta) { Position += Velocity * delta; }
+};
+
+REFLECTABLE_DECLARATION(BenchmarkBody)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(BenchmarkBody)
+    FUNCTION(Update)
+REFLECTABLE_INIT()
+
+template <typename FunctionType>
+void measure(char const* name, std::size_t ticks, std::size_t count, FunctionType&& function)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t tick = 0; tick < ticks; ++tick) function();
+    auto finish = std::chrono::steady_clock::now();
+
+    auto total = std::chrono::duration<double, std::nano>(finish - start).count();
+    std::cout << name << ": " << total / double(ticks * count) << " ns/object\n";
+}
+
+int main()
+{
+    constexpr std::size_t count = 10000;
+    constexpr std::size_t ticks = 200;
+
+    auto update = eightrefl::global()->find("BenchmarkBody")->reflection->function.find("Update")->find("void(float)");
+
+    std::vector<BenchmarkBody> bodies(count);
+    float delta = 0.016f;
+
+    measure("direct", ticks, count, [&]
+    {
+        for (auto& body : bodies) body.Update(delta);
+    });
+
+    measure("call", ticks, count, [&]
+    {
+        std::vector<std::any> arguments = { delta };
+        for (auto& body : bodies) update->call(&body, arguments);
+    });
+
+    measure("raw_call", ticks, count, [&]
+    {
+        void* arguments[] = { &delta };
+        for (auto& body : bodies) update->raw_call(&body, arguments, nullptr);
+    });
+
+    measure("raw_batch_call", ticks, count, [&]
+    {
+        void* arguments[] = { &delta };
+        update->raw_batch_call(eightrefl::batch_of(bodies.data(), bodies.size()), arguments, nullptr);
+    });
+
+    std::vector<BenchmarkBody*> contexts;
+    for (auto& body : bodies) contexts.push_back(&body);
+
+    measure("raw_batch_call (indirect)", ticks, count, [&]
+    {
+        void* arguments[] = { &delta };
+        update->raw_batch_call(eightrefl::batch_of(contexts.data(), contexts.size()), arguments, nullptr);
+    });
+
+    return bodies.front().Position > 0.f ? 0 : 1;
+}
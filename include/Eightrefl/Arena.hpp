@@ -0,0 +1,49 @@
+#ifndef EIGHTREFL_ARENA_HPP
+#define EIGHTREFL_ARENA_HPP
+
+#include <cstddef> // size_t
+
+#include <vector> // vector
+#include <mutex> // mutex
+
+#ifndef EIGHTREFL_ARENA_BLOCK_SIZE
+    #define EIGHTREFL_ARENA_BLOCK_SIZE std::size_t(64 * 1024)
+#endif // EIGHTREFL_ARENA_BLOCK_SIZE
+
+namespace eightrefl
+{
+
+// monotonic thread-safe allocator, memory is released all at once on destruction,
+// objects placed into arena should be destroyed manually, e.g. item->~MetaType()
+struct arena_t
+{
+    explicit arena_t(std::size_t block_size = EIGHTREFL_ARENA_BLOCK_SIZE) : block_size(block_size) {}
+    ~arena_t();
+
+    arena_t(arena_t const&) = delete;
+    arena_t& operator=(arena_t const&) = delete;
+
+    void* allocate(std::size_t size, std::size_t alignment);
+
+    std::size_t capacity() const; // bytes reserved by blocks
+    std::size_t used() const; // bytes handed out by allocate, without alignment padding
+
+    std::size_t const block_size;
+
+private:
+    struct block_t
+    {
+        char* data = nullptr;
+        std::size_t size = 0;
+    };
+
+    mutable std::mutex mutex;
+    std::vector<block_t> blocks;
+    char* top = nullptr; // free space of last block
+    char* end = nullptr;
+    std::size_t used_size = 0;
+};
+
+} // namespace eightrefl
+
+#endif // EIGHTREFL_ARENA_HPP
@@ -3,32 +3,186 @@
 
 #include <string> // string
 #include <unordered_map> // unordered_map
+#include <type_traits> // true_type, false_type, void_t
+#include <utility> // declval
+#include <new> // placement new
+#include <stdexcept> // logic_error
+#include <mutex> // unique_lock
+#include <shared_mutex> // shared_lock
+
+#include <Eightrefl/Name.hpp>
+#include <Eightrefl/Lock.hpp>
+#include <Eightrefl/Arena.hpp>
+#include <Eightrefl/Profiler.hpp>
 
 namespace eightrefl
 {
 
+template <class MetaType>
+struct attribute_t;
+
+namespace detail
+{
+
+template <class MetaType, typename enable = void>
+struct has_meta_attribute : std::false_type {};
+
+template <class MetaType>
+struct has_meta_attribute<MetaType, std::void_t<decltype(std::declval<MetaType&>().meta.freeze())>> : std::true_type {};
+
+template <class MetaType>
+struct is_attribute : std::false_type {};
+
+template <class MetaType>
+struct is_attribute<attribute_t<MetaType>> : std::true_type {};
+
+} // namespace detail
+
 template <class MetaType>
 struct attribute_t
 {
+    attribute_t() = default;
+
+    // items are copied, so copy owns its items and allocates them without arena, copy is never frozen
+    attribute_t(attribute_t const& other)
+    {
+        copy(other);
+    }
+
+    attribute_t& operator=(attribute_t const& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            copy(other);
+        }
+        return *this;
+    }
+
     ~attribute_t()
     {
-        for (auto const& [key, item] : all) delete item;
+        clear();
     }
 
-    MetaType* find(std::string const& name) const
+    // lookup by name does not allocate, and does not hash, if name was hashed before,
+    // takes shared lock, so it may run concurrently with add, but readers still contend on lock,
+    // frozen attribute is read without lock, misses included, since nothing is added to it
+    MetaType* find(hashed_name_t const& name) const
     {
+        if (frozen()) return frozen_index.find(name);
+
+        std::shared_lock<std::shared_mutex> lock(shared_mutex_of(this));
+
         auto it = all.find(name);
         return it != all.end() ? it->second : nullptr;
     }
 
+    MetaType* find(std::string const& name) const { return find(hashed_name_t(name)); }
+    MetaType* find(char const* name) const { return find(hashed_name_t(name)); }
+
+    // returns already added item with the same name, if any,
+    // may run concurrently with find and add, but not with iteration over all,
+    // throws std::logic_error on new item, if attribute is frozen
     MetaType* add(std::string const& name, MetaType const& meta)
     {
-        auto item = new MetaType(meta);
-        all.emplace(name, item);
+        #ifdef EIGHTREFL_PROFILER_ENABLE
+        profile_add_t xxprofile;
+        #endif // EIGHTREFL_PROFILER_ENABLE
+
+        std::unique_lock<std::shared_mutex> lock(shared_mutex_of(this));
+
+        hashed_name_t key(name);
+
+        auto it = all.find(key);
+        if (it != all.end()) return it->second;
+
+        if (frozen()) throw std::logic_error("eightrefl::attribute_t: add to frozen attribute");
+
+        auto item = arena != nullptr
+            ? new (arena->allocate(sizeof(MetaType), alignof(MetaType))) MetaType(meta)
+            : new MetaType(meta);
+
+        // nested attributes share arena, unless copied items are already owned by them
+        if constexpr (detail::is_attribute<MetaType>::value)
+        {
+            if (item->all.empty()) item->arena = arena;
+        }
+        else if constexpr (detail::has_meta_attribute<MetaType>::value)
+        {
+            if (item->meta.all.empty()) item->meta.arena = arena;
+        }
+
+        // key views interned text, that outlives attribute
+        all.emplace(hashed_name_t(intern(key.name).name(), key.hash), item);
+
+        #ifdef EIGHTREFL_PROFILER_ENABLE
+        ++detail::profile_counter().attribute_count;
+        #endif // EIGHTREFL_PROFILER_ENABLE
+
         return item;
     }
 
-    std::unordered_map<std::string, MetaType*> all;
+    // adds flat name index for attribute itself and nested attributes of its items,
+    // items are not moved, so any pointers to them stay valid,
+    // neither freeze nor thaw may run concurrently with other access
+    void freeze()
+    {
+        for (auto const& [key, item] : all)
+        {
+            if constexpr (detail::is_attribute<MetaType>::value) item->freeze();
+            else if constexpr (detail::has_meta_attribute<MetaType>::value) item->meta.freeze();
+        }
+
+        frozen_index.build(all);
+        is_frozen = true;
+    }
+
+    void thaw()
+    {
+        for (auto const& [key, item] : all)
+        {
+            if constexpr (detail::is_attribute<MetaType>::value) item->thaw();
+            else if constexpr (detail::has_meta_attribute<MetaType>::value) item->meta.thaw();
+        }
+
+        if (!frozen()) return;
+
+        frozen_index.clear();
+        is_frozen = false;
+    }
+
+    bool frozen() const { return is_frozen; }
+
+    // keys view interned names, iteration is not synchronized, so it should not run concurrently with add,
+    // key is hashed_name_t rather than std::string, its text is key.name
+    std::unordered_map<hashed_name_t, MetaType*, hashed_name_t::hasher> all;
+    name_index_t<MetaType> frozen_index;
+    arena_t* arena = nullptr; // allocates items, if any, usually arena of registry
+
+private:
+    void copy(attribute_t const& other)
+    {
+        all.reserve(other.all.size());
+        for (auto const& [key, item] : other.all) all.emplace(key, new MetaType(*item));
+    }
+
+    void clear()
+    {
+        for (auto const& [key, item] : all)
+        {
+            if (arena != nullptr) item->~MetaType(); // memory is owned by arena
+            else delete item;
+        }
+
+        all.clear();
+        arena = nullptr;
+
+        frozen_index.clear();
+        is_frozen = false;
+    }
+
+private:
+    bool is_frozen = false;
 };
 
 } // namespace eightrefl
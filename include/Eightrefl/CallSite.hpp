@@ -0,0 +1,71 @@
+#ifndef EIGHTREFL_CALL_SITE_HPP
+#define EIGHTREFL_CALL_SITE_HPP
+
+#include <cstddef> // size_t
+
+#include <string> // string
+#include <vector> // vector
+#include <any> // any
+
+#include <Eightrefl/Utility.hpp>
+
+#ifndef EIGHTREFL_CALL_SITE_CACHE_SIZE
+    #define EIGHTREFL_CALL_SITE_CACHE_SIZE std::size_t(4)
+#endif // EIGHTREFL_CALL_SITE_CACHE_SIZE
+
+namespace eightrefl
+{
+
+struct type_t;
+struct function_t;
+struct parent_t;
+
+// polymorphic inline cache of function lookup by receiver type,
+// function may be inherited, so receiver context should be casted by parent path before call
+struct call_site_t
+{
+    struct target_t
+    {
+        type_t* type = nullptr;
+        function_t* function = nullptr;
+        std::vector<parent_t*> path;
+
+        void* cast(void* context) const;
+        std::any cast(std::any const& context) const;
+    };
+
+    std::string const name;
+    std::string const signature; // may be empty, if function has single overload
+
+    call_site_t(std::string const& name, std::string const& signature = {})
+        : name(name), signature(signature) {}
+
+    // returns nullptr if receiver type has no such function
+    target_t const* find(type_t* type)
+    {
+        for (auto const& target : cache)
+        {
+            if (target.type == type) return target.function != nullptr ? &target : nullptr;
+        }
+        return lookup(type);
+    }
+
+    // returns false if receiver type has no such function
+    bool raw_call(type_t* type, void* context, void* const* arguments, void* result);
+
+    // returns not_callable if receiver type has no such function, see function_t::try_call
+    call_status_t call(type_t* type, std::any const& context, std::vector<std::any> const& arguments, std::any& result);
+
+    void clear();
+
+private:
+    target_t const* lookup(type_t* type);
+
+private:
+    target_t cache[EIGHTREFL_CALL_SITE_CACHE_SIZE];
+    std::size_t next = 0;
+};
+
+} // namespace eightrefl
+
+#endif // EIGHTREFL_CALL_SITE_HPP
@@ -0,0 +1,39 @@
+#ifndef EIGHTREFL_DELEGATE_HPP
+#define EIGHTREFL_DELEGATE_HPP
+
+#include <string> // string
+#include <any> // any
+
+#include <Eightrefl/Function.hpp>
+
+namespace eightrefl
+{
+
+struct type_t;
+
+// function bound to object ahead of time, object is already casted to class, that declares function,
+// so call does not cast context or walk parents
+struct delegate_t
+{
+    function_t* function = nullptr;
+    void* context = nullptr; // nullptr for static or free function
+
+    explicit operator bool() const { return function != nullptr; }
+
+    void operator()(void* const* arguments, void* result) const
+    {
+        function->raw_call(context, arguments, result);
+    }
+};
+
+// object is pointer to instance of type, function may be inherited,
+// signature may be empty, if function has single overload,
+// returns empty delegate if type has no such function
+delegate_t bind(type_t* type, void* object, std::string const& name, std::string const& signature = {});
+
+// object holds instance of type, that should outlive delegate
+delegate_t bind(type_t* type, std::any& object, std::string const& name, std::string const& signature = {});
+
+} // namespace eightrefl
+
+#endif // EIGHTREFL_DELEGATE_HPP
@@ -1,6 +1,8 @@
 #ifndef EIGHTREFL_DELETER_HPP
 #define EIGHTREFL_DELETER_HPP
 
+#include <cstddef> // size_t
+
 #include <string> // string
 #include <any> // any
 #include <functional> // function
@@ -26,7 +28,20 @@ struct deleter_t
 {
     std::string const name;
     std::function<void(std::any const& context)> const call = nullptr;
+    std::function<void(void* context, std::size_t count)> const raw_call = nullptr;
     attribute_t<meta_t> meta;
+
+    // destroys object in given storage, storage memory is not released
+    void destroy_at(void* context) const
+    {
+        raw_call(context, 1);
+    }
+
+    // destroys count contiguous objects in reverse order
+    void destroy_array_at(void* context, std::size_t count) const
+    {
+        raw_call(context, count);
+    }
 };
 
 template <typename ReflectableType>
@@ -47,6 +62,26 @@ auto handler_deleter_call(CustomDeleterType(*)(ReflectableType*))
     };
 }
 
+template <typename ReflectableType>
+auto handler_deleter_raw_call(void(*)(ReflectableType*))
+{
+    return [](void* context, std::size_t count)
+    {
+        auto reflectable = static_cast<ReflectableType*>(context);
+        while (count > 0) reflectable[--count].~ReflectableType();
+    };
+}
+
+template <typename CustomDeleterType, typename ReflectableType>
+auto handler_deleter_raw_call(CustomDeleterType(*)(ReflectableType*))
+{
+    return [](void* context, std::size_t count)
+    {
+        auto reflectable = static_cast<ReflectableType*>(context);
+        while (count > 0) CustomDeleterType(reflectable + --count);
+    };
+}
+
 } // namespace eightrefl
 
 #endif // EIGHTREFL_DELETER_HPP
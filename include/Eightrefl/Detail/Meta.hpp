@@ -3,6 +3,7 @@
 
 #include <type_traits> // conjunction, disjunction, false_type, true_type, void_t
 #include <utility> // pair
+#include <initializer_list> // initializer_list
 
 template <typename ReflectableType, typename enable = void>
 struct xxeightrefl_alias { using R = ReflectableType; };
@@ -39,9 +40,21 @@ struct to_reflectable_pointer { using type = std::remove_const_t<std::remove_poi
 template <typename ObjectType>
 struct to_reflectable_object { using type = std::remove_const_t<ObjectType>; };
 
+template <typename Type>
+struct to_reflectable : std::conditional_t
+<
+    std::is_reference_v<Type>,
+    to_reflectable_reference<Type>,
+    std::conditional_t<std::is_pointer_v<Type>, to_reflectable_pointer<Type>, to_reflectable_object<Type>>
+> {};
+
 template <typename, typename enable = void> struct is_complete : std::false_type {};
 template <typename Type> struct is_complete<Type, std::void_t<decltype(sizeof(Type))>> : std::true_type {};
 
+// initializer_list does not own its array, so it is never constructed in raw storage
+template <typename> struct is_initializer_list : std::false_type {};
+template <typename ElementType> struct is_initializer_list<std::initializer_list<ElementType>> : std::true_type {};
+
 template <typename, typename enable = void> struct is_custom_name : std::false_type {};
 template <typename ReflectableType>
 struct is_custom_name<ReflectableType, std::void_t<decltype(&::xxeightrefl_traits<ReflectableType>::name)>> : std::true_type {};
@@ -10,6 +10,7 @@
 #include <Eightrefl/Standard/unordered_map.hpp>
 
 #include <Eightrefl/Dev/Dev.hpp>
+#include <Eightrefl/Dev/Name.hpp>
 
 TEMPLATE_REFLECTABLE_DECLARATION((template <typename MetaType>), eightrefl::attribute_t<MetaType>)
     REFLECTABLE_REGISTRY(eightrefl::dev())
@@ -17,8 +18,11 @@ TEMPLATE_REFLECTABLE_DECLARATION((template <typename MetaType>), eightrefl::attr
 REFLECTABLE_DECLARATION_INIT()
 
 TEMPLATE_REFLECTABLE((template <typename MetaType>), eightrefl::attribute_t<MetaType>)
-    FUNCTION(find)
+    FUNCTION(find, MetaType*(std::string const&) const)
     FUNCTION(add)
+    FUNCTION(freeze)
+    FUNCTION(thaw)
+    FUNCTION(frozen)
     PROPERTY(all)
 REFLECTABLE_INIT()
 #endif // EIGHTREFL_DEV_ENABLE
@@ -0,0 +1,22 @@
+#ifndef EIGHTREFL_DEV_NAME_HPP
+#define EIGHTREFL_DEV_NAME_HPP
+
+#ifdef EIGHTREFL_DEV_ENABLE
+#include <Eightrefl/Reflectable.hpp>
+
+#include <Eightrefl/Dev/Dev.hpp>
+
+REFLECTABLE_DECLARATION(eightrefl::atom_t)
+    REFLECTABLE_REGISTRY(eightrefl::dev())
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE_DECLARATION(eightrefl::hashed_name_t)
+    REFLECTABLE_REGISTRY(eightrefl::dev())
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE_DECLARATION(eightrefl::hashed_name_t::hasher)
+    REFLECTABLE_REGISTRY(eightrefl::dev())
+REFLECTABLE_DECLARATION_INIT()
+#endif // EIGHTREFL_DEV_ENABLE
+
+#endif // EIGHTREFL_DEV_NAME_HPP
@@ -0,0 +1,92 @@
+#ifndef EIGHTREFL_EXECUTOR_HPP
+#define EIGHTREFL_EXECUTOR_HPP
+
+#ifdef EIGHTREFL_EXECUTOR_ENABLE
+#include <cstddef> // size_t
+
+#include <vector> // vector
+#include <deque> // deque
+#include <any> // any
+#include <future> // future, promise
+#include <thread> // thread
+#include <mutex> // mutex
+#include <condition_variable> // condition_variable
+#include <atomic> // atomic
+#include <memory> // unique_ptr
+#include <optional> // optional
+#include <algorithm> // min
+
+#ifndef EIGHTREFL_EXECUTOR_MAX_SIZE
+    #define EIGHTREFL_EXECUTOR_MAX_SIZE std::size_t(4)
+#endif // EIGHTREFL_EXECUTOR_MAX_SIZE
+
+#ifndef EIGHTREFL_EXECUTOR_SIZE
+    #define EIGHTREFL_EXECUTOR_SIZE std::min(std::size_t(std::thread::hardware_concurrency()), EIGHTREFL_EXECUTOR_MAX_SIZE)
+#endif // EIGHTREFL_EXECUTOR_SIZE
+
+namespace eightrefl
+{
+
+struct function_t;
+struct factory_t;
+
+// work-stealing thread pool, that runs reflective calls through their move_call handlers,
+// calls with the same strand are pinned to one worker, so they run in order and never concurrently
+struct executor_t
+{
+    explicit executor_t(std::size_t size = EIGHTREFL_EXECUTOR_SIZE);
+    ~executor_t(); // runs all submitted calls before join
+
+    executor_t(executor_t const&) = delete;
+    executor_t& operator=(executor_t const&) = delete;
+
+    // strand is usually address of context object, nullptr to run call on any worker
+    std::future<std::any> submit(function_t const* function, std::any const& context,
+                                 std::vector<std::any>&& arguments, void const* strand = nullptr);
+
+    std::future<std::any> submit(factory_t const* factory, std::vector<std::any>&& arguments);
+
+    std::size_t size() const { return workers.size(); }
+
+private:
+    struct task_t
+    {
+        function_t const* function = nullptr;
+        factory_t const* factory = nullptr;
+        std::any context;
+        std::vector<std::any> arguments;
+        std::promise<std::any> promise;
+
+        void run();
+    };
+
+    struct worker_t
+    {
+        std::mutex mutex;
+        std::deque<task_t> shared; // may be stolen by other workers
+        std::deque<task_t> pinned; // strand calls, run by this worker only
+        std::atomic<std::size_t> pinned_count = 0;
+        std::thread thread;
+    };
+
+    std::future<std::any> push(task_t&& task, void const* strand);
+    std::optional<task_t> pop(std::size_t index);
+    void work(std::size_t index);
+
+private:
+    std::vector<std::unique_ptr<worker_t>> workers;
+    std::atomic<std::size_t> next = 0;
+    std::atomic<std::size_t> shared_count = 0;
+    std::mutex sleep_mutex;
+    std::condition_variable sleep;
+    bool stop = false;
+};
+
+// library-provided executor, that is used by call_async,
+// its workers are started by the first call, and are joined at exit
+executor_t* executor();
+
+} // namespace eightrefl
+#endif // EIGHTREFL_EXECUTOR_ENABLE
+
+#endif // EIGHTREFL_EXECUTOR_HPP
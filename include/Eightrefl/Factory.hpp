@@ -1,12 +1,20 @@
 #ifndef EIGHTREFL_FACTORY_HPP
 #define EIGHTREFL_FACTORY_HPP
 
+#include <cstddef> // size_t
+
 #include <string> // string
 #include <vector> // vector
 #include <any> // any
 #include <functional> // function
+#ifdef EIGHTREFL_EXECUTOR_ENABLE
+#include <future> // future
+#endif // EIGHTREFL_EXECUTOR_ENABLE
+#include <new> // placement new
+#include <type_traits> // is_aggregate_v, is_copy_constructible_v
 
 #include <Eightrefl/Attribute.hpp>
+#include <Eightrefl/Type.hpp>
 #include <Eightrefl/Utility.hpp>
 
 // .factory<function_type>()
@@ -21,16 +29,52 @@
 namespace eightrefl
 {
 
-struct type_t;
 struct meta_t;
 
 struct factory_t
 {
     std::string const name;
     std::function<std::any(std::vector<std::any> const& args)> const call = nullptr;
+    std::function<void(void* const* args, void* result)> const raw_call = nullptr; // leaves args intact, value parameters get copies
+    std::function<void(void* const* args, void* result)> const raw_move_call = nullptr; // moves from args of value parameters
     std::vector<type_t*> const arguments;
     type_t* const result = nullptr;
     attribute_t<meta_t> meta;
+
+    // moves owned args into constructor, throws std::bad_any_cast on mismatch like call
+    std::any move_call(std::vector<std::any>& args) const;
+
+    // reuses result storage, held result of the same type is assigned in place
+    void call_into(std::vector<std::any> const& args, std::any& result) const;
+
+    // checked counterpart of call_into, that reports mismatch instead of throwing
+    call_status_t try_call(std::vector<std::any> const& args, std::any& result) const;
+
+    // checked counterpart of raw_call, types are types of args, that should match arguments exactly
+    call_status_t try_raw_call(std::vector<type_t*> const& types, void* const* args, void* result) const
+    {
+        if (raw_call == nullptr) return call_status_t::not_callable;
+        if (types.size() != arguments.size()) return call_status_t::argument_count_mismatch;
+        if (types != arguments) return call_status_t::argument_type_mismatch;
+
+        raw_call(args, result);
+        return call_status_t::success;
+    }
+
+    #ifdef EIGHTREFL_EXECUTOR_ENABLE
+    // runs move_call on library executor, args are captured by move
+    std::future<std::any> call_async(std::vector<std::any> args) const;
+    #endif // EIGHTREFL_EXECUTOR_ENABLE
+
+    // constructs object in given storage, that should fit result size and alignment, like raw_call leaves args intact
+    void construct_at(void* storage, void* const* args) const
+    {
+        raw_call(args, storage);
+    }
+
+    // constructs count contiguous objects from the same args, that are left intact like raw_call,
+    // if any construction throws, already constructed objects are destroyed
+    void construct_array_at(void* storage, std::size_t count, void* const* args) const;
 };
 
 namespace detail
@@ -52,15 +96,55 @@ auto handler_factory_call_impl(std::index_sequence<ArgumentIndexValues...>)
     };
 }
 
+template <bool MoveArguments, typename ReflectableType, typename... ArgumentTypes, std::size_t... ArgumentIndexValues>
+auto handler_factory_raw_call_impl(std::index_sequence<ArgumentIndexValues...>)
+{
+    return [](void* const* arguments, void* result)
+    {
+        if constexpr (std::is_aggregate_v<ReflectableType>)
+        {
+            ::new (result) ReflectableType{ utility::pass<ArgumentTypes, MoveArguments>(arguments[ArgumentIndexValues])... };
+        }
+        else
+        {
+            ::new (result) ReflectableType( utility::pass<ArgumentTypes, MoveArguments>(arguments[ArgumentIndexValues])... );
+        }
+    };
+}
+
 } // namespace detail
 
 template <typename ReflectableType, typename... ArgumentTypes>
 auto handler_factory_call(ReflectableType(*)(ArgumentTypes...))
 {
-    return detail::handler_factory_call_impl<ReflectableType, ArgumentTypes...>
-    (
-        std::index_sequence_for<ArgumentTypes...>{}
-    );
+    // std::any holds only copy constructible objects, others are constructed by raw_call
+    if constexpr (!std::is_copy_constructible_v<ReflectableType>)
+    {
+        return nullptr;
+    }
+    else
+    {
+        return detail::handler_factory_call_impl<ReflectableType, ArgumentTypes...>
+        (
+            std::index_sequence_for<ArgumentTypes...>{}
+        );
+    }
+}
+
+template <bool MoveArguments = false, typename ReflectableType, typename... ArgumentTypes>
+auto handler_factory_raw_call(ReflectableType(*)(ArgumentTypes...))
+{
+    if constexpr (meta::is_initializer_list<ReflectableType>::value)
+    {
+        return nullptr;
+    }
+    else
+    {
+        return detail::handler_factory_raw_call_impl<MoveArguments, ReflectableType, ArgumentTypes...>
+        (
+            std::index_sequence_for<ArgumentTypes...>{}
+        );
+    }
 }
 
 } // namespace eightrefl
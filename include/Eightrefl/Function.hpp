@@ -6,7 +6,13 @@
 #include <string> // string
 #include <vector> // vector
 #include <any> // any
-#include <functional> // function
+#include <tuple> // forward_as_tuple, get
+#include <functional> // function, invoke
+#ifdef EIGHTREFL_EXECUTOR_ENABLE
+#include <future> // future
+#endif // EIGHTREFL_EXECUTOR_ENABLE
+#include <type_traits> // conditional_t, is_function_v, add_pointer_t
+#include <utility> // forward
 
 #include <Eightrefl/Attribute.hpp>
 #include <Eightrefl/Utility.hpp>
@@ -34,14 +40,80 @@ namespace eightrefl
 struct type_t;
 struct meta_t;
 
+// typed handle to reflected function pointer, that can be invoked without any conversions
+template <typename FunctionPointerType>
+struct invoker_t
+{
+    FunctionPointerType pointer = nullptr;
+
+    explicit operator bool() const { return pointer != nullptr; }
+
+    // member function pointer requires object reference or pointer as first argument
+    template <typename... ArgumentTypes>
+    decltype(auto) operator()(ArgumentTypes&&... arguments) const
+    {
+        return std::invoke(pointer, std::forward<ArgumentTypes>(arguments)...);
+    }
+};
+
 struct function_t
 {
     std::string const name;
     std::function<std::any(std::any const& context, std::vector<std::any> const& args)> const call = nullptr;
+    std::function<void(void* context, void* const* args, void* result)> const raw_call = nullptr; // leaves args intact, value parameters get copies
+    std::function<void(void* context, void* const* args, void* result)> const raw_move_call = nullptr; // moves from args of value parameters
+    std::function<void(batch_t const& contexts, void* const* args, void* results)> const raw_batch_call = nullptr;
+    void* (*const raw_object)(std::any const& context) = nullptr; // object of context, nullptr on mismatch, nullptr for free function
     std::vector<type_t*> const arguments;
+    std::vector<std::size_t> const pointer_arguments; // indices of pointer parameters, since pointers share type_t with references
     type_t* const result = nullptr;
     std::any const pointer;
     attribute_t<meta_t> meta;
+
+    // moves owned args into function, throws std::bad_any_cast on mismatch like call
+    std::any move_call(std::any const& context, std::vector<std::any>& args) const;
+
+    // reuses result storage, held result of the same type is assigned in place
+    void call_into(std::any const& context, std::vector<std::any> const& args, std::any& result) const;
+
+    // checked counterpart of call_into, that reports mismatch instead of throwing
+    call_status_t try_call(std::any const& context, std::vector<std::any> const& args, std::any& result) const;
+
+    // checked counterpart of raw_call, types are types of args, that should match arguments exactly,
+    // use raw_call directly to skip check, once call site is known to be correct
+    call_status_t try_raw_call(void* context, std::vector<type_t*> const& types, void* const* args, void* result) const
+    {
+        if (raw_call == nullptr) return call_status_t::not_callable;
+        if (types.size() != arguments.size()) return call_status_t::argument_count_mismatch;
+        if (types != arguments) return call_status_t::argument_type_mismatch;
+
+        raw_call(context, args, result);
+        return call_status_t::success;
+    }
+
+    #ifdef EIGHTREFL_EXECUTOR_ENABLE
+    // runs move_call on library executor, args are captured by move,
+    // calls with the same strand, e.g. address of context object, run in submission order one by one
+    std::future<std::any> call_async(std::any const& context, std::vector<std::any> args, void const* strand = nullptr) const;
+    #endif // EIGHTREFL_EXECUTOR_ENABLE
+
+    // FunctionType is R(Args...) for free function or R(C::*)(Args...) [const][&] for member function,
+    // returns empty invoker if signature does not match stored pointer
+    template <typename FunctionType>
+    auto as() const
+    {
+        using function_pointer = std::conditional_t
+        <
+            std::is_function_v<FunctionType>, std::add_pointer_t<FunctionType>, FunctionType
+        >;
+
+        invoker_t<function_pointer> invoker;
+
+        auto xxpointer = std::any_cast<function_pointer>(&pointer);
+        if (xxpointer != nullptr) invoker.pointer = *xxpointer;
+
+        return invoker;
+    }
 };
 
 namespace detail
@@ -89,6 +161,73 @@ auto handler_free_function_call_impl(ReturnType(*function)(ArgumentTypes...), st
     };
 }
 
+template <bool MoveArguments, typename ReflectableType, typename ReturnType, typename... ArgumentTypes,
+          typename FunctionType, std::size_t... ArgumentIndexValues>
+auto handler_member_function_raw_call_impl(FunctionType function, std::index_sequence<ArgumentIndexValues...>)
+{
+    return [function](void* context, void* const* arguments, void* result)
+    {
+        auto reflectable = static_cast<ReflectableType*>(context);
+        if constexpr (std::is_void_v<ReturnType>)
+        {
+            (reflectable->*function)(utility::pass<ArgumentTypes, MoveArguments>(arguments[ArgumentIndexValues])...);
+        }
+        else
+        {
+            utility::backward
+            (
+                result, (reflectable->*function)(utility::pass<ArgumentTypes, MoveArguments>(arguments[ArgumentIndexValues])...)
+            );
+        }
+    };
+}
+
+template <bool MoveArguments, typename ReturnType, typename... ArgumentTypes, std::size_t... ArgumentIndexValues>
+auto handler_free_function_raw_call_impl(ReturnType(*function)(ArgumentTypes...), std::index_sequence<ArgumentIndexValues...>)
+{
+    return [function](void*, void* const* arguments, void* result)
+    {
+        if constexpr (std::is_void_v<ReturnType>)
+        {
+            function(utility::pass<ArgumentTypes, MoveArguments>(arguments[ArgumentIndexValues])...);
+        }
+        else
+        {
+            utility::backward
+            (
+                result, function(utility::pass<ArgumentTypes, MoveArguments>(arguments[ArgumentIndexValues])...)
+            );
+        }
+    };
+}
+
+template <typename ReflectableType, typename ReturnType, typename... ArgumentTypes,
+          typename FunctionType, std::size_t... ArgumentIndexValues>
+auto handler_member_function_raw_batch_call_impl(FunctionType function, std::index_sequence<ArgumentIndexValues...>)
+{
+    return [function](batch_t const& contexts, void* const* arguments, void* results)
+    {
+        // shared arguments are resolved once per batch and passed as lvalues, so no call can move from them
+        auto xxarguments = std::forward_as_tuple(utility::lvalue<ArgumentTypes>(arguments[ArgumentIndexValues])...);
+
+        for (std::size_t index = 0; index < contexts.count; ++index)
+        {
+            auto reflectable = static_cast<ReflectableType*>(contexts[index]);
+            if constexpr (std::is_void_v<ReturnType>)
+            {
+                (reflectable->*function)(std::get<ArgumentIndexValues>(xxarguments)...);
+            }
+            else
+            {
+                using result_type = typename meta::to_reflectable<ReturnType>::type;
+                auto result = results == nullptr ? nullptr : static_cast<result_type*>(results) + index;
+
+                utility::backward(result, (reflectable->*function)(std::get<ArgumentIndexValues>(xxarguments)...));
+            }
+        }
+    };
+}
+
 } // namespace detail
 
 template <typename ReflectableType, typename ReturnType, typename... ArgumentTypes>
@@ -133,6 +272,84 @@ auto handler_function_call(ReturnType(*function)(ArgumentTypes...))
     return detail::handler_free_function_call_impl(function, std::index_sequence_for<ArgumentTypes...>{});
 }
 
+template <bool MoveArguments = false, typename ReflectableType, typename ReturnType, typename... ArgumentTypes>
+auto handler_function_raw_call(ReturnType(ReflectableType::* function)(ArgumentTypes...) const)
+{
+    return detail::handler_member_function_raw_call_impl<MoveArguments, ReflectableType, ReturnType, ArgumentTypes...>
+    (
+        function, std::index_sequence_for<ArgumentTypes...>{}
+    );
+}
+
+template <bool MoveArguments = false, typename ReflectableType, typename ReturnType, typename... ArgumentTypes>
+auto handler_function_raw_call(ReturnType(ReflectableType::* function)(ArgumentTypes...) const&)
+{
+    return detail::handler_member_function_raw_call_impl<MoveArguments, ReflectableType, ReturnType, ArgumentTypes...>
+    (
+        function, std::index_sequence_for<ArgumentTypes...>{}
+    );
+}
+
+template <bool MoveArguments = false, typename ReflectableType, typename ReturnType, typename... ArgumentTypes>
+auto handler_function_raw_call(ReturnType(ReflectableType::* function)(ArgumentTypes...))
+{
+    return detail::handler_member_function_raw_call_impl<MoveArguments, ReflectableType, ReturnType, ArgumentTypes...>
+    (
+        function, std::index_sequence_for<ArgumentTypes...>{}
+    );
+}
+
+template <bool MoveArguments = false, typename ReflectableType, typename ReturnType, typename... ArgumentTypes>
+auto handler_function_raw_call(ReturnType(ReflectableType::* function)(ArgumentTypes...)&)
+{
+    return detail::handler_member_function_raw_call_impl<MoveArguments, ReflectableType, ReturnType, ArgumentTypes...>
+    (
+        function, std::index_sequence_for<ArgumentTypes...>{}
+    );
+}
+
+template <bool MoveArguments = false, typename ReturnType, typename... ArgumentTypes>
+auto handler_function_raw_call(ReturnType(*function)(ArgumentTypes...))
+{
+    return detail::handler_free_function_raw_call_impl<MoveArguments>(function, std::index_sequence_for<ArgumentTypes...>{});
+}
+
+template <typename ReflectableType, typename ReturnType, typename... ArgumentTypes>
+auto handler_function_raw_batch_call(ReturnType(ReflectableType::* function)(ArgumentTypes...) const)
+{
+    return detail::handler_member_function_raw_batch_call_impl<ReflectableType, ReturnType, ArgumentTypes...>
+    (
+        function, std::index_sequence_for<ArgumentTypes...>{}
+    );
+}
+
+template <typename ReflectableType, typename ReturnType, typename... ArgumentTypes>
+auto handler_function_raw_batch_call(ReturnType(ReflectableType::* function)(ArgumentTypes...) const&)
+{
+    return detail::handler_member_function_raw_batch_call_impl<ReflectableType, ReturnType, ArgumentTypes...>
+    (
+        function, std::index_sequence_for<ArgumentTypes...>{}
+    );
+}
+
+template <typename ReflectableType, typename ReturnType, typename... ArgumentTypes>
+auto handler_function_raw_batch_call(ReturnType(ReflectableType::* function)(ArgumentTypes...))
+{
+    return detail::handler_member_function_raw_batch_call_impl<ReflectableType, ReturnType, ArgumentTypes...>
+    (
+        function, std::index_sequence_for<ArgumentTypes...>{}
+    );
+}
+
+template <typename ReflectableType, typename ReturnType, typename... ArgumentTypes>
+auto handler_function_raw_batch_call(ReturnType(ReflectableType::* function)(ArgumentTypes...)&)
+{
+    return detail::handler_member_function_raw_batch_call_impl<ReflectableType, ReturnType, ArgumentTypes...>
+    (
+        function, std::index_sequence_for<ArgumentTypes...>{}
+    );
+}
+
 } // namespace eightrefl
 
 #endif // EIGHTREFL_FUNCTION_HPP
@@ -0,0 +1,25 @@
+#ifndef EIGHTREFL_LOCK_HPP
+#define EIGHTREFL_LOCK_HPP
+
+#include <cstddef> // size_t
+
+#include <mutex> // recursive_mutex
+#include <shared_mutex> // shared_mutex
+
+#ifndef EIGHTREFL_LOCK_SHARD_COUNT
+    #define EIGHTREFL_LOCK_SHARD_COUNT std::size_t(64)
+#endif // EIGHTREFL_LOCK_SHARD_COUNT
+
+namespace eightrefl
+{
+
+// serializes evaluation of reflection, reentrant, since evaluation of one type registers other ones
+extern std::recursive_mutex& registration_mutex();
+
+// guards registry or attribute maps, lock is chosen from fixed set by container address,
+// so unrelated containers rarely share one, readers share lock with each other
+extern std::shared_mutex& shared_mutex_of(void const* address);
+
+} // namespace eightrefl
+
+#endif // EIGHTREFL_LOCK_HPP
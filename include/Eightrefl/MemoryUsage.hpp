@@ -0,0 +1,39 @@
+#ifndef EIGHTREFL_MEMORY_USAGE_HPP
+#define EIGHTREFL_MEMORY_USAGE_HPP
+
+#include <cstddef> // size_t
+
+namespace eightrefl
+{
+
+// approximate bytes held by registry metadata, by category,
+// map nodes are estimated from element count and bucket count, since allocator is not observed,
+// parent, factory, function, property, deleter, meta and injection include their attribute maps
+struct memory_usage_t
+{
+    std::size_t type = 0;
+    std::size_t reflection = 0;
+    std::size_t parent = 0;
+    std::size_t factory = 0;
+    std::size_t function = 0;
+    std::size_t property = 0;
+    std::size_t deleter = 0;
+    std::size_t meta = 0;
+    std::size_t injection = 0;
+    std::size_t name = 0; // heap buffers of names, that exceed small string buffer, map keys view interned names
+    std::size_t handler = 0; // std::function handlers, closures capture pointers only, so they stay inline
+    std::size_t index = 0; // registry maps and name indices
+    std::size_t rtti_all = 0;
+    std::size_t arena_slack = 0; // bytes reserved by arena, but not handed out to metadata
+    std::size_t atom_pool = 0; // interned names, that map keys view, pool is shared by all registries, so each counts it
+
+    std::size_t total() const
+    {
+        return type + reflection + parent + factory + function + property + deleter + meta + injection
+             + name + handler + index + rtti_all + arena_slack + atom_pool;
+    }
+};
+
+} // namespace eightrefl
+
+#endif // EIGHTREFL_MEMORY_USAGE_HPP
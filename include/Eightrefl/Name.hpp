@@ -0,0 +1,172 @@
+#ifndef EIGHTREFL_NAME_HPP
+#define EIGHTREFL_NAME_HPP
+
+#include <cstddef> // size_t
+#include <cstdint> // uint32_t
+
+#include <string> // string
+#include <string_view> // string_view
+#include <vector> // vector
+#include <utility> // pair
+#include <algorithm> // sort
+
+namespace eightrefl
+{
+
+// non-owning name with hash, that is computed once,
+// e.g. at compile time: static constexpr eightrefl::hashed_name_t name = "TestStruct";
+struct hashed_name_t
+{
+    struct hasher
+    {
+        std::size_t operator()(hashed_name_t const& name) const { return name.hash; }
+    };
+
+    std::string_view name;
+    std::size_t hash = 0;
+
+    constexpr hashed_name_t() : hashed_name_t(std::string_view()) {}
+    constexpr hashed_name_t(std::string_view name, std::size_t hash) : name(name), hash(hash) {}
+    constexpr hashed_name_t(std::string_view name) : name(name), hash(hash_of(name)) {}
+    constexpr hashed_name_t(char const* name) : hashed_name_t(std::string_view(name)) {}
+    hashed_name_t(std::string const& name) : hashed_name_t(std::string_view(name)) {}
+
+    // FNV-1a
+    static constexpr std::size_t hash_of(std::string_view name)
+    {
+        auto hash = std::size_t(sizeof(std::size_t) == 8 ? 14695981039346656037ull : 2166136261u);
+        auto prime = std::size_t(sizeof(std::size_t) == 8 ? 1099511628211ull : 16777619u);
+
+        for (auto symbol : name)
+        {
+            hash ^= static_cast<unsigned char>(symbol);
+            hash *= prime;
+        }
+        return hash;
+    }
+
+    friend constexpr bool operator==(hashed_name_t const& lhs, hashed_name_t const& rhs)
+    {
+        return lhs.hash == rhs.hash && lhs.name == rhs.name;
+    }
+
+    friend constexpr bool operator!=(hashed_name_t const& lhs, hashed_name_t const& rhs)
+    {
+        return !(lhs == rhs);
+    }
+};
+
+// process-wide interned name, equal names share the same id, so comparison is a single integer compare,
+// interned text lives until process exit
+struct atom_t
+{
+    struct hasher
+    {
+        std::size_t operator()(atom_t const& atom) const { return atom.id; }
+    };
+
+    std::uint32_t id = 0; // 0 is empty name
+
+    std::string_view name() const; // does not lock, text is never moved, so keys of registry and attributes view it
+
+    friend constexpr bool operator==(atom_t const& lhs, atom_t const& rhs) { return lhs.id == rhs.id; }
+    friend constexpr bool operator!=(atom_t const& lhs, atom_t const& rhs) { return lhs.id != rhs.id; }
+};
+
+// returns atom of name, interns name on first call, thread-safe
+extern atom_t intern(std::string_view name);
+
+// returns empty atom, if name was never interned
+extern atom_t find_atom(std::string_view name);
+
+// approximate bytes held by interned names and their lookup map, thread-safe
+extern std::size_t atom_pool_usage();
+
+// read-only flat name index, built once from existing [name, value] pairs,
+// entries are ordered by [hash, name] in eytzinger layout, so lookup walks down an implicit tree,
+// where top levels share a few cache lines, and names are compared only on hash equality
+template <typename ValueType>
+struct name_index_t
+{
+    struct entry_t
+    {
+        std::size_t hash = 0;
+        ValueType* value = nullptr;
+    };
+
+    std::vector<entry_t> entries; // 1-based, entries[0] is unused
+    std::vector<std::string_view> names; // parallel to entries
+
+    template <class MapType>
+    void build(MapType const& all)
+    {
+        std::vector<std::pair<hashed_name_t, ValueType*>> sorted;
+        sorted.reserve(all.size());
+
+        for (auto const& [key, item] : all) sorted.emplace_back(hashed_name_t(key), item);
+
+        std::sort(sorted.begin(), sorted.end(), [](auto const& lhs, auto const& rhs)
+        {
+            return less(lhs.first, rhs.first);
+        });
+
+        entries.assign(sorted.size() + 1, entry_t{});
+        names.assign(sorted.size() + 1, std::string_view());
+
+        std::size_t position = 0;
+        fill(sorted, position, 1);
+    }
+
+    void clear()
+    {
+        entries = {};
+        names = {};
+    }
+
+    ValueType* find(hashed_name_t const& name) const
+    {
+        auto const size = entries.size();
+
+        std::size_t k = 1;
+        while (k < size)
+        {
+            k = 2 * k + (less(entries[k].hash, names[k], name) ? 1 : 0);
+        }
+
+        // drop trailing 'right' turns and the last 'left' one, to get lower bound
+        while (k & 1) k >>= 1;
+        k >>= 1;
+
+        if (k == 0 || entries[k].hash != name.hash || names[k] != name.name) return nullptr;
+        return entries[k].value;
+    }
+
+private:
+    static bool less(hashed_name_t const& lhs, hashed_name_t const& rhs)
+    {
+        return less(lhs.hash, lhs.name, rhs);
+    }
+
+    static bool less(std::size_t hash, std::string_view name, hashed_name_t const& rhs)
+    {
+        return hash < rhs.hash || (hash == rhs.hash && name < rhs.name);
+    }
+
+    // in-order traversal of implicit tree assigns sorted items
+    void fill(std::vector<std::pair<hashed_name_t, ValueType*>> const& sorted, std::size_t& position, std::size_t k)
+    {
+        if (k >= entries.size()) return;
+
+        fill(sorted, position, 2 * k);
+
+        auto const& [name, value] = sorted[position++];
+        entries[k] = { name.hash, value };
+        names[k] = name.name;
+
+        fill(sorted, position, 2 * k + 1);
+    }
+};
+
+} // namespace eightrefl
+
+#endif // EIGHTREFL_NAME_HPP
@@ -2,6 +2,7 @@
 #define EIGHTREFL_PARENT_HPP
 
 #include <string> // string
+#include <vector> // vector
 #include <any> // any
 #include <functional> // function
 
@@ -26,6 +27,7 @@ struct parent_t
     std::string const name;
     type_t* const type = nullptr;
     std::function<std::any(std::any const& child_context)> const cast = nullptr;
+    std::function<void*(void* child_context)> const raw_cast = nullptr;
     attribute_t<meta_t> meta;
 };
 
@@ -38,6 +40,19 @@ auto handler_parent_cast()
     };
 }
 
+template <typename ReflectableType, typename ParentReflectableType>
+auto handler_parent_raw_cast()
+{
+    return [](void* child_context) -> void*
+    {
+        return static_cast<ParentReflectableType*>(static_cast<ReflectableType*>(child_context));
+    };
+}
+
+// depth-first walk through type and its parents, where path holds parents from type to visited one,
+// stops once visit returns true, so path leads to that type
+extern bool walk_parents(type_t* type, std::vector<parent_t*>& path, std::function<bool(type_t* type)> const& visit);
+
 } // namespace eightrefl
 
 #endif // EIGHTREFL_PARENT_HPP
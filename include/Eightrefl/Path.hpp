@@ -0,0 +1,66 @@
+#ifndef EIGHTREFL_PATH_HPP
+#define EIGHTREFL_PATH_HPP
+
+#include <cstddef> // size_t
+
+#include <string> // string
+#include <vector> // vector
+#include <functional> // function
+
+namespace eightrefl
+{
+
+struct type_t;
+struct property_t;
+
+// compiled access plan for chained path like "root.transform.position.x",
+// where each, except last, name is a property or function without arguments, that returns reference or pointer,
+// and last name is a property, pointers are loaded automatically
+struct path_t
+{
+    struct step_t
+    {
+        std::size_t offset = 0; // folded offset of data members, applied first
+        std::function<void*(void* context)> hop = nullptr; // getter, function or parent cast, applied next
+        std::size_t loads = 0; // number of pointer loads, applied last
+    };
+
+    type_t* type = nullptr; // type of root object
+    property_t* property = nullptr; // last property in path
+    std::vector<step_t> steps; // from root object to owner of last property
+
+    explicit operator bool() const { return property != nullptr; }
+
+    // returns nullptr if any of pointers on the way is null
+    void* owner(void* object) const
+    {
+        auto context = static_cast<char*>(object);
+        for (auto const& step : steps)
+        {
+            context += step.offset;
+            if (step.hop != nullptr) context = static_cast<char*>(step.hop(context));
+
+            for (std::size_t index = 0; index < step.loads && context != nullptr; ++index)
+            {
+                context = *reinterpret_cast<char**>(context);
+            }
+
+            if (context == nullptr) return nullptr;
+        }
+        return context;
+    }
+
+    // returns address of last property, or nullptr if it's not addressable
+    void* context(void* object) const;
+
+    // returns false if owner of last property is unreachable or property is not readable/writable
+    bool raw_get(void* object, void* result) const;
+    bool raw_set(void* object, void* value) const;
+};
+
+// returns empty path if any name was not found or is not accessible by address
+path_t compile_path(type_t* type, std::string const& path);
+
+} // namespace eightrefl
+
+#endif // EIGHTREFL_PATH_HPP
@@ -0,0 +1,104 @@
+#ifndef EIGHTREFL_PROFILER_HPP
+#define EIGHTREFL_PROFILER_HPP
+
+#ifdef EIGHTREFL_PROFILER_ENABLE
+#include <cstddef> // size_t
+
+#include <string> // string
+#include <vector> // vector
+#include <unordered_map> // unordered_map
+#include <mutex> // mutex
+#include <chrono> // nanoseconds, steady_clock
+
+namespace eightrefl
+{
+
+struct registry_t;
+
+// cost of reflection evaluation, evaluations of other types nested into it are excluded
+struct profile_t
+{
+    std::string name;
+    registry_t* registry = nullptr;
+    std::chrono::nanoseconds time = {};
+    std::chrono::nanoseconds add_time = {}; // part of time spent in add of types and attributes
+    std::size_t evaluation_count = 0;
+    std::size_t allocation_count = 0;
+    std::size_t allocation_size = 0;
+    std::size_t attribute_count = 0;
+    std::size_t type_count = 0; // types added to registry
+};
+
+// collects cost of reflection evaluation per type and per registry,
+// allocations are counted only if EightreflAllocationHook, that replaces global operator new, is linked into executable
+struct profiler_t
+{
+    void clear();
+
+    // most expensive by time first
+    std::vector<profile_t> top(std::size_t count) const;
+
+    std::string report(std::size_t count = 16) const;
+    std::string report_json(std::size_t count = 16) const;
+
+    void add(profile_t const& profile);
+    void add_type(registry_t* registry);
+
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, profile_t> type;
+    std::unordered_map<registry_t*, profile_t> registry;
+};
+
+extern profiler_t* profiler();
+
+namespace detail
+{
+
+struct profile_counter_t
+{
+    std::chrono::nanoseconds add_time = {};
+    std::size_t allocation_count = 0;
+    std::size_t allocation_size = 0;
+    std::size_t attribute_count = 0;
+    bool paused = false;
+};
+
+// counters of current thread
+extern profile_counter_t& profile_counter();
+
+} // namespace detail
+
+// measures one add of type or attribute on current thread
+struct profile_add_t
+{
+    profile_add_t() : start_time(std::chrono::steady_clock::now()) {}
+    ~profile_add_t() { detail::profile_counter().add_time += std::chrono::steady_clock::now() - start_time; }
+
+    profile_add_t(profile_add_t const&) = delete;
+    profile_add_t& operator=(profile_add_t const&) = delete;
+
+    std::chrono::steady_clock::time_point start_time;
+};
+
+// measures evaluation of one type on current thread, scopes may nest
+struct profile_scope_t
+{
+    profile_scope_t(std::string name, registry_t* registry);
+    ~profile_scope_t();
+
+    profile_scope_t(profile_scope_t const&) = delete;
+    profile_scope_t& operator=(profile_scope_t const&) = delete;
+
+    std::string name;
+    registry_t* registry = nullptr;
+
+    profile_t nested; // total cost of nested scopes
+    detail::profile_counter_t start;
+    std::chrono::steady_clock::time_point start_time;
+    profile_scope_t* parent = nullptr;
+};
+
+} // namespace eightrefl
+#endif // EIGHTREFL_PROFILER_ENABLE
+
+#endif // EIGHTREFL_PROFILER_HPP
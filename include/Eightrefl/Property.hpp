@@ -1,12 +1,14 @@
 #ifndef EIGHTREFL_PROPERTY_HPP
 #define EIGHTREFL_PROPERTY_HPP
 
+#include <cstddef> // size_t
+
 #include <string> // string
 #include <any> // any
 #include <utility> // pair
 #include <functional> // function
 #include <memory> // addressof
-#include <type_traits> // is_reference_v
+#include <type_traits> // is_reference_v, is_member_function_pointer_v, is_function_v, is_trivially_copyable_v, is_standard_layout_v
 
 #include <Eightrefl/Attribute.hpp>
 #include <Eightrefl/Utility.hpp>
@@ -40,13 +42,43 @@ struct meta_t;
 
 struct property_t
 {
+    static constexpr auto npos = std::size_t(-1);
+
     std::string const name;
     type_t* const type = nullptr;
     std::function<void(std::any const& context, std::any& result)> const get = nullptr;
     std::function<void(std::any const& context, std::any const& value)> const set = nullptr;
     std::function<std::any(std::any const& outer_context)> const context = nullptr;
+    std::function<void(void* context, void* result)> const raw_get = nullptr;
+    std::function<void(void* context, void* value)> const raw_set = nullptr; // leaves value intact, owned type gets copy
+    std::function<void(void* context, void* value)> const raw_move_set = nullptr; // moves from value of owned type
+    std::function<void*(void* outer_context)> const raw_context = nullptr;
+    std::function<void(batch_t const& contexts, void* results)> const raw_batch_get = nullptr;
+    std::function<void(batch_t const& contexts, void* value)> const raw_batch_set = nullptr;
+    void* (*const raw_object)(std::any const& context) = nullptr; // object of context, nullptr on mismatch, nullptr for static property
+    std::size_t const offset = npos; // byte offset of data member in object of standard-layout type
+    std::size_t const size = 0; // size of data member
+    std::size_t const alignment = 0; // alignment of data member
+    bool const plain = false; // is data member of trivially copyable type, that can be copied by bytes
     std::pair<std::any, std::any> const pointer;
     attribute_t<meta_t> meta;
+
+    // moves owned value into property, throws std::bad_any_cast on mismatch like set,
+    // and std::bad_function_call for readonly property
+    void move_set(std::any const& context, std::any& value) const;
+
+    // checked counterpart of set, that reports mismatch instead of throwing
+    call_status_t try_set(std::any const& context, std::any const& value) const;
+
+    // checked counterpart of raw_set, value_type is type of value, that should match property type exactly
+    call_status_t try_raw_set(void* context, type_t* value_type, void* value) const
+    {
+        if (raw_set == nullptr) return call_status_t::not_callable;
+        if (value_type != type) return call_status_t::argument_type_mismatch;
+
+        raw_set(context, value);
+        return call_status_t::success;
+    }
 };
 
 namespace detail
@@ -59,9 +91,9 @@ auto handler_property_get_impl(GetterType property)
     {
         using property_type = typename meta::property_traits<GetterType>::type;
 
-        value = utility::backward<property_type>
+        utility::assign<property_type>
         (
-            (std::any_cast<ReflectableType*>(context)->*property)()
+            value, (std::any_cast<ReflectableType*>(context)->*property)()
         );
     };
 }
@@ -73,9 +105,9 @@ auto handler_property_get(PropertyType ReflectableType::* property)
 {
     return [property](std::any const& context, std::any& result)
     {
-        result = utility::forward<PropertyType>
+        utility::assign<PropertyType>
         (
-            std::any_cast<ReflectableType*>(context)->*property
+            result, std::any_cast<ReflectableType*>(context)->*property
         );
     };
 }
@@ -109,7 +141,7 @@ auto handler_property_get(PropertyType* property)
 {
     return [property](std::any const&, std::any& result)
     {
-        result = utility::forward<PropertyType>(*property);
+        utility::assign<PropertyType>(result, *property);
     };
 }
 
@@ -118,7 +150,7 @@ auto handler_property_get(PropertyType(*property)(void))
 {
     return [property](std::any const&, std::any& result)
     {
-        result = utility::backward<PropertyType>(property());
+        utility::assign<PropertyType>(result, property());
     };
 }
 
@@ -308,6 +340,480 @@ auto handler_property_context(PropertyType(*property)(void))
     }
 }
 
+namespace detail
+{
+
+template <typename ReflectableType, typename GetterType>
+auto handler_property_raw_get_impl(GetterType property)
+{
+    return [property](void* context, void* result)
+    {
+        utility::backward(result, (static_cast<ReflectableType*>(context)->*property)());
+    };
+}
+
+} // namespace detail
+
+template <typename ReflectableType, typename PropertyType>
+auto handler_property_raw_get(PropertyType ReflectableType::* property)
+{
+    return [property](void* context, void* result)
+    {
+        utility::backward(result, PropertyType(static_cast<ReflectableType*>(context)->*property));
+    };
+}
+
+template <typename ReflectableType, typename PropertyType>
+auto handler_property_raw_get(PropertyType(ReflectableType::* property)(void) const)
+{
+    return detail::handler_property_raw_get_impl<ReflectableType>(property);
+}
+
+template <typename ReflectableType, typename PropertyType>
+auto handler_property_raw_get(PropertyType(ReflectableType::* property)(void) const&)
+{
+    return detail::handler_property_raw_get_impl<ReflectableType>(property);
+}
+
+template <typename ReflectableType, typename PropertyType>
+auto handler_property_raw_get(PropertyType(ReflectableType::* property)(void))
+{
+    return detail::handler_property_raw_get_impl<ReflectableType>(property);
+}
+
+template <typename ReflectableType, typename PropertyType>
+auto handler_property_raw_get(PropertyType(ReflectableType::* property)(void)&)
+{
+    return detail::handler_property_raw_get_impl<ReflectableType>(property);
+}
+
+template <typename PropertyType>
+auto handler_property_raw_get(PropertyType* property)
+{
+    return [property](void*, void* result)
+    {
+        utility::backward(result, PropertyType(*property));
+    };
+}
+
+template <typename PropertyType>
+auto handler_property_raw_get(PropertyType(*property)(void))
+{
+    return [property](void*, void* result)
+    {
+        utility::backward(result, property());
+    };
+}
+
+namespace detail
+{
+
+template <bool MoveValue, typename ReflectableType, typename SetterType>
+auto handler_property_raw_set_impl(SetterType property)
+{
+    return [property](void* context, void* value)
+    {
+        using property_type = typename meta::property_traits<SetterType>::type;
+
+        (static_cast<ReflectableType*>(context)->*property)(utility::pass<property_type, MoveValue>(value));
+    };
+}
+
+} // namespace detail
+
+template <bool MoveValue = false, typename ReflectableType, typename PropertyType>
+auto handler_property_raw_set(PropertyType ReflectableType::* property)
+{
+    return [property](void* context, void* value)
+    {
+        static_cast<ReflectableType*>(context)->*property = utility::pass<PropertyType, MoveValue>(value);
+    };
+}
+
+template <bool MoveValue = false, typename ReflectableType, typename PropertyType>
+auto handler_property_raw_set(PropertyType const ReflectableType::* property)
+{
+    return nullptr;
+}
+
+template <bool MoveValue = false, typename ReflectableType, typename PropertyType>
+auto handler_property_raw_set(void(ReflectableType::* property)(PropertyType))
+{
+    return detail::handler_property_raw_set_impl<MoveValue, ReflectableType>(property);
+}
+
+template <bool MoveValue = false, typename ReflectableType, typename PropertyType>
+auto handler_property_raw_set(void(ReflectableType::* property)(PropertyType)&)
+{
+    return detail::handler_property_raw_set_impl<MoveValue, ReflectableType>(property);
+}
+
+template <bool MoveValue = false, typename PropertyType>
+auto handler_property_raw_set(PropertyType* property)
+{
+    return [property](void*, void* value)
+    {
+        *property = utility::pass<PropertyType, MoveValue>(value);
+    };
+}
+
+template <bool MoveValue = false, typename PropertyType>
+auto handler_property_raw_set(PropertyType const* property)
+{
+    return nullptr;
+}
+
+template <bool MoveValue = false, typename PropertyType>
+auto handler_property_raw_set(void(*property)(PropertyType))
+{
+    return [property](void*, void* value)
+    {
+        property(utility::pass<PropertyType, MoveValue>(value));
+    };
+}
+
+template <bool MoveValue = false, typename ReflectableType, typename PropertyType>
+auto handler_property_raw_set(PropertyType(ReflectableType::* property)(void) const)
+{
+    return nullptr;
+}
+
+template <bool MoveValue = false, typename ReflectableType, typename PropertyType>
+auto handler_property_raw_set(PropertyType(ReflectableType::* property)(void) const&)
+{
+    return nullptr;
+}
+
+template <bool MoveValue = false, typename ReflectableType, typename PropertyType>
+auto handler_property_raw_set(PropertyType(ReflectableType::* property)(void))
+{
+    return nullptr;
+}
+
+template <bool MoveValue = false, typename ReflectableType, typename PropertyType>
+auto handler_property_raw_set(PropertyType(ReflectableType::* property)(void)&)
+{
+    return nullptr;
+}
+
+template <bool MoveValue = false, typename PropertyType>
+auto handler_property_raw_set(PropertyType(*property)(void))
+{
+    return nullptr;
+}
+
+namespace detail
+{
+
+template <typename ReflectableType, typename GetterType>
+auto handler_property_raw_context_impl(GetterType property)
+{
+    using property_type = typename meta::property_traits<GetterType>::type;
+    if constexpr (std::is_reference_v<property_type>)
+    {
+        return [property](void* outer_context) -> void*
+        {
+            return const_cast<typename meta::to_reflectable_reference<property_type>::type>
+            (
+                std::addressof((static_cast<ReflectableType*>(outer_context)->*property)())
+            );
+        };
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+} // namespace detail
+
+template <typename ReflectableType, typename PropertyType>
+auto handler_property_raw_context(PropertyType ReflectableType::* property)
+{
+    return [property](void* outer_context) -> void*
+    {
+        return const_cast<typename meta::to_reflectable_object<PropertyType>::type*>
+        (
+            std::addressof(static_cast<ReflectableType*>(outer_context)->*property)
+        );
+    };
+}
+
+template <typename ReflectableType, typename PropertyType>
+auto handler_property_raw_context(PropertyType(ReflectableType::* property)(void) const)
+{
+    return detail::handler_property_raw_context_impl<ReflectableType>(property);
+}
+
+template <typename ReflectableType, typename PropertyType>
+auto handler_property_raw_context(PropertyType(ReflectableType::* property)(void) const&)
+{
+    return detail::handler_property_raw_context_impl<ReflectableType>(property);
+}
+
+template <typename ReflectableType, typename PropertyType>
+auto handler_property_raw_context(PropertyType(ReflectableType::* property)(void))
+{
+    return detail::handler_property_raw_context_impl<ReflectableType>(property);
+}
+
+template <typename ReflectableType, typename PropertyType>
+auto handler_property_raw_context(PropertyType(ReflectableType::* property)(void)&)
+{
+    return detail::handler_property_raw_context_impl<ReflectableType>(property);
+}
+
+template <typename PropertyType>
+auto handler_property_raw_context(PropertyType* property)
+{
+    return [property](void*) -> void*
+    {
+        return const_cast<typename meta::to_reflectable_object<PropertyType>::type*>(property);
+    };
+}
+
+template <typename PropertyType>
+auto handler_property_raw_context(PropertyType(*property)(void))
+{
+    if constexpr (std::is_reference_v<PropertyType>)
+    {
+        return [property](void*) -> void*
+        {
+            return const_cast<typename meta::to_reflectable_reference<PropertyType>::type>
+            (
+                std::addressof(property())
+            );
+        };
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+namespace detail
+{
+
+template <typename ReflectableType, typename PropertyType, typename GetterType>
+auto handler_property_raw_batch_get_impl(GetterType property)
+{
+    return [property](batch_t const& contexts, void* results)
+    {
+        using result_type = typename meta::to_reflectable<PropertyType>::type;
+
+        for (std::size_t index = 0; index < contexts.count; ++index)
+        {
+            auto reflectable = static_cast<ReflectableType*>(contexts[index]);
+            auto result = static_cast<result_type*>(results) + index;
+            if constexpr (std::is_member_function_pointer_v<GetterType>)
+            {
+                utility::backward(result, (reflectable->*property)());
+            }
+            else
+            {
+                utility::backward(result, PropertyType(reflectable->*property));
+            }
+        }
+    };
+}
+
+template <typename ReflectableType, typename PropertyType, typename SetterType>
+auto handler_property_raw_batch_set_impl(SetterType property)
+{
+    return [property](batch_t const& contexts, void* value)
+    {
+        // shared value is converted once per batch
+        auto&& xxvalue = utility::forward<PropertyType>(value);
+
+        for (std::size_t index = 0; index < contexts.count; ++index)
+        {
+            auto reflectable = static_cast<ReflectableType*>(contexts[index]);
+            if constexpr (std::is_member_function_pointer_v<SetterType>)
+            {
+                (reflectable->*property)(xxvalue);
+            }
+            else
+            {
+                reflectable->*property = xxvalue;
+            }
+        }
+    };
+}
+
+} // namespace detail
+
+template <typename ReflectableType, typename PropertyType>
+auto handler_property_raw_batch_get(PropertyType ReflectableType::* property)
+{
+    return detail::handler_property_raw_batch_get_impl<ReflectableType, PropertyType>(property);
+}
+
+template <typename ReflectableType, typename PropertyType>
+auto handler_property_raw_batch_get(PropertyType(ReflectableType::* property)(void) const)
+{
+    return detail::handler_property_raw_batch_get_impl<ReflectableType, PropertyType>(property);
+}
+
+template <typename ReflectableType, typename PropertyType>
+auto handler_property_raw_batch_get(PropertyType(ReflectableType::* property)(void) const&)
+{
+    return detail::handler_property_raw_batch_get_impl<ReflectableType, PropertyType>(property);
+}
+
+template <typename ReflectableType, typename PropertyType>
+auto handler_property_raw_batch_get(PropertyType(ReflectableType::* property)(void))
+{
+    return detail::handler_property_raw_batch_get_impl<ReflectableType, PropertyType>(property);
+}
+
+template <typename ReflectableType, typename PropertyType>
+auto handler_property_raw_batch_get(PropertyType(ReflectableType::* property)(void)&)
+{
+    return detail::handler_property_raw_batch_get_impl<ReflectableType, PropertyType>(property);
+}
+
+// static property has no context to batch over
+template <typename PropertyType>
+auto handler_property_raw_batch_get(PropertyType* property)
+{
+    return nullptr;
+}
+
+template <typename PropertyType>
+auto handler_property_raw_batch_get(PropertyType(*property)(void))
+{
+    return nullptr;
+}
+
+template <typename ReflectableType, typename PropertyType>
+auto handler_property_raw_batch_set(PropertyType ReflectableType::* property)
+{
+    return detail::handler_property_raw_batch_set_impl<ReflectableType, PropertyType>(property);
+}
+
+template <typename ReflectableType, typename PropertyType>
+auto handler_property_raw_batch_set(PropertyType const ReflectableType::* property)
+{
+    return nullptr;
+}
+
+template <typename ReflectableType, typename PropertyType>
+auto handler_property_raw_batch_set(void(ReflectableType::* property)(PropertyType))
+{
+    return detail::handler_property_raw_batch_set_impl<ReflectableType, PropertyType>(property);
+}
+
+template <typename ReflectableType, typename PropertyType>
+auto handler_property_raw_batch_set(void(ReflectableType::* property)(PropertyType)&)
+{
+    return detail::handler_property_raw_batch_set_impl<ReflectableType, PropertyType>(property);
+}
+
+template <typename PropertyType>
+auto handler_property_raw_batch_set(PropertyType* property)
+{
+    return nullptr;
+}
+
+template <typename PropertyType>
+auto handler_property_raw_batch_set(void(*property)(PropertyType))
+{
+    return nullptr;
+}
+
+template <typename ReflectableType, typename PropertyType>
+auto handler_property_raw_batch_set(PropertyType(ReflectableType::* property)(void) const)
+{
+    return nullptr;
+}
+
+template <typename ReflectableType, typename PropertyType>
+auto handler_property_raw_batch_set(PropertyType(ReflectableType::* property)(void) const&)
+{
+    return nullptr;
+}
+
+template <typename ReflectableType, typename PropertyType>
+auto handler_property_raw_batch_set(PropertyType(ReflectableType::* property)(void))
+{
+    return nullptr;
+}
+
+template <typename ReflectableType, typename PropertyType>
+auto handler_property_raw_batch_set(PropertyType(ReflectableType::* property)(void)&)
+{
+    return nullptr;
+}
+
+template <typename PropertyType>
+auto handler_property_raw_batch_set(PropertyType(*property)(void))
+{
+    return nullptr;
+}
+
+template <typename GetterType>
+std::size_t property_offset(GetterType)
+{
+    return property_t::npos;
+}
+
+template <typename ReflectableType, typename PropertyType>
+std::size_t property_offset(PropertyType ReflectableType::* property)
+{
+    if constexpr (std::is_function_v<PropertyType> || !std::is_standard_layout_v<ReflectableType>)
+    {
+        // layout of other types, e.g. with vptr or virtual bases, is up to compiler, so they are reached by handlers only
+        return property_t::npos;
+    }
+    else
+    {
+        // member pointer is applied to storage only to get address, object is neither constructed nor accessed
+        alignas(ReflectableType) static unsigned char storage[sizeof(ReflectableType)];
+        auto object = reinterpret_cast<ReflectableType const*>(storage);
+
+        auto offset = reinterpret_cast<unsigned char const*>(std::addressof(object->*property)) - storage;
+        return std::size_t(offset);
+    }
+}
+
+template <typename GetterType>
+constexpr std::size_t property_size(GetterType)
+{
+    return 0;
+}
+
+template <typename ReflectableType, typename PropertyType>
+constexpr std::size_t property_size(PropertyType ReflectableType::*)
+{
+    if constexpr (std::is_function_v<PropertyType>) return 0;
+    else return sizeof(PropertyType);
+}
+
+template <typename GetterType>
+constexpr std::size_t property_alignment(GetterType)
+{
+    return 0;
+}
+
+template <typename ReflectableType, typename PropertyType>
+constexpr std::size_t property_alignment(PropertyType ReflectableType::*)
+{
+    if constexpr (std::is_function_v<PropertyType>) return 0;
+    else return alignof(PropertyType);
+}
+
+template <typename GetterType>
+constexpr bool property_plain(GetterType)
+{
+    return false;
+}
+
+template <typename ReflectableType, typename PropertyType>
+constexpr bool property_plain(PropertyType ReflectableType::*)
+{
+    return !std::is_function_v<PropertyType> && std::is_trivially_copyable_v<PropertyType>;
+}
+
 template <typename ipropertyterType, typename opropertyterType>
 constexpr auto property_pointer(ipropertyterType iproperty, opropertyterType oproperty)
 {
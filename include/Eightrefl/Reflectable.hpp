@@ -3,7 +3,14 @@
 
 #include <cstddef> // size_t
 
+#include <atomic> // atomic
+#include <mutex> // lock_guard, recursive_mutex
+#include <type_traits> // remove_const_t, is_member_function_pointer_v, is_pointer_v
+#include <utility> // move
+
 #include <Eightrefl/Registry.hpp>
+#include <Eightrefl/Lock.hpp>
+#include <Eightrefl/Profiler.hpp>
 #include <Eightrefl/Injection.hpp>
 #include <Eightrefl/Parent.hpp>
 #include <Eightrefl/Factory.hpp>
@@ -65,16 +72,22 @@
         eightrefl::add_default_injection_set<R>(xxtype); \
         injection.template type<R>(*xxtype); \
 
-#ifdef EIGHTREFL_DISABLE_REFLECTION_FIXTURE
+#if defined(EIGHTREFL_DISABLE_REFLECTION_FIXTURE)
+    #define REFLECTABLE_INIT() \
+            } \
+        };
+#elif defined(EIGHTREFL_DEFER_REFLECTION_FIXTURE)
+    // reflection is evaluated on first lookup of type by name, see registry_t::defer
     #define REFLECTABLE_INIT() \
             } \
+            inline static auto xxfixture = (eightrefl::defer_reflectable<R>(), true); \
         };
 #else
     #define REFLECTABLE_INIT() \
             } \
             inline static auto xxfixture = (eightrefl::reflectable<R>(), true); \
         };
-#endif // EIGHTREFL_DISABLE_REFLECTION_FIXTURE
+#endif // EIGHTREFL_DISABLE_REFLECTION_FIXTURE, EIGHTREFL_DEFER_REFLECTION_FIXTURE
 
 
 #define REFLECTABLE_INJECTION_DECLARATION(injection_index, ... /*reflectable_type*/) \
@@ -121,13 +134,26 @@ std::string name_of()
 template <typename ReflectableType>
 using clean_of = typename ::xxeightrefl_alias<ReflectableType>::R;
 
+template <typename ReflectableType>
+registry_t* registry_of();
+
+// thread-safe, concurrent callers wait until reflection is evaluated
 template <typename ReflectableType>
 void reflectable()
 {
+    static std::atomic<bool> done{ false }; if (done.load(std::memory_order_acquire)) return;
+
+    std::lock_guard<std::recursive_mutex> guard(registration_mutex());
+
     static auto lock = false; if (lock) return;
     lock = true;
 
+    #ifdef EIGHTREFL_PROFILER_ENABLE
+    profile_scope_t xxprofile(name_of<ReflectableType>(), registry_of<ReflectableType>());
+    #endif // EIGHTREFL_PROFILER_ENABLE
+
     ::xxeightrefl<ReflectableType>::evaluate(injectable_t{});
+    done.store(true, std::memory_order_release);
 }
 
 template <typename ReflectableType>
@@ -137,23 +163,40 @@ ReflectableType&& reflectable(ReflectableType&& object)
     return std::forward<ReflectableType>(object);
 }
 
+template <typename ReflectableType>
+registry_t* registry_of()
+{
+    if constexpr (meta::is_custom_registry<ReflectableType>::value)
+    {
+        return ::xxeightrefl_traits<ReflectableType>::registry();
+    }
+    else
+    {
+        return global();
+    }
+}
+
+// records only name of type in its registry, reflection is evaluated on first lookup by that name
 template <typename DirtyReflectableType>
-type_t* find_or_add_type()
+void defer_reflectable()
 {
-    using dirty_reflectable_type = typename std::conditional_t
-    <
-        std::is_reference_v<DirtyReflectableType>,
-        meta::to_reflectable_reference<DirtyReflectableType>,
-        std::conditional_t
-        <
-            std::is_pointer_v<DirtyReflectableType>,
-            meta::to_reflectable_pointer<DirtyReflectableType>,
-            meta::to_reflectable_object<DirtyReflectableType>
-        >
-    >::type;
+    using dirty_reflectable_type = typename meta::to_reflectable<DirtyReflectableType>::type;
+    registry_of<dirty_reflectable_type>()->defer(name_of<dirty_reflectable_type>(), &reflectable<DirtyReflectableType>);
+}
+
+// unlike find_or_add_type, does not register type and does not evaluate its reflection
+template <typename DirtyReflectableType>
+type_t* find_type()
+{
+    using dirty_reflectable_type = typename meta::to_reflectable<DirtyReflectableType>::type;
+    return registry_of<dirty_reflectable_type>()->find(name_of<dirty_reflectable_type>());
+}
 
+template <typename DirtyReflectableType>
+type_t* find_or_add_type()
+{
+    using dirty_reflectable_type = typename meta::to_reflectable<DirtyReflectableType>::type;
     using reflectable_type = typename ::xxeightrefl_alias<dirty_reflectable_type>::R;
-    using reflectable_traits = ::xxeightrefl_traits<dirty_reflectable_type>;
 
     if constexpr (meta::is_lazy<dirty_reflectable_type>::value)
     {
@@ -161,14 +204,9 @@ type_t* find_or_add_type()
     }
 
     auto xxname = name_of<dirty_reflectable_type>();
-    auto xxregistry = global();
-
-    if constexpr (meta::is_custom_registry<dirty_reflectable_type>::value)
-    {
-        xxregistry = reflectable_traits::registry();
-    }
+    auto xxregistry = registry_of<dirty_reflectable_type>();
 
-    auto xxtype = xxregistry->all[xxname];
+    auto xxtype = xxregistry->find(xxname);
     if (xxtype == nullptr)
     {
         xxtype = xxregistry->template add<reflectable_type, dirty_reflectable_type>(xxname);
@@ -198,7 +236,8 @@ parent_t* find_or_add_parent(reflection_t* reflection)
         {
             xxname,
             find_or_add_type<ParentReflectableType>(),
-            handler_parent_cast<ReflectableType, ParentReflectableType>()
+            handler_parent_cast<ReflectableType, ParentReflectableType>(),
+            handler_parent_raw_cast<ReflectableType, ParentReflectableType>()
         }
     );
 
@@ -214,6 +253,17 @@ auto function_argument_types(ReturnType(*unused)(ArgumentTypes...))
     return std::vector<type_t*>({ find_or_add_type<ArgumentTypes>()... });
 }
 
+template <typename... ArgumentTypes, typename ReturnType>
+auto function_pointer_arguments(ReturnType(*unused)(ArgumentTypes...))
+{
+    std::vector<std::size_t> indices;
+
+    [[maybe_unused]] std::size_t index = 0;
+    ((std::is_pointer_v<ArgumentTypes> ? indices.push_back(index++) : void(++index)), ...);
+
+    return indices;
+}
+
 template <typename... ArgumentTypes, typename ReturnType>
 auto function_return_type(ReturnType(*unused)(ArgumentTypes...))
 {
@@ -239,6 +289,8 @@ factory_t* find_or_add_factory(reflection_t* reflection)
         {
             xxname,
             handler_factory_call(pointer{}),
+            handler_factory_raw_call(pointer{}),
+            handler_factory_raw_call<true>(pointer{}),
             detail::function_argument_types(dirty_pointer{}),
             detail::function_return_type(dirty_pointer{})
         }
@@ -269,19 +321,28 @@ function_t* find_or_add_function(reflection_t* reflection, std::string const& na
     auto xxoverload = name_of<dirty_type>();
 
     auto xxmeta = xxfunction->find(xxoverload);
-    if (xxmeta == nullptr) xxmeta = xxfunction->add
+    if (xxmeta != nullptr) return xxmeta;
+
+    // free function has no context to batch over
+    std::remove_const_t<decltype(function_t::raw_batch_call)> xxbatch = nullptr;
+    if constexpr (std::is_member_function_pointer_v<FunctionType>) xxbatch = handler_function_raw_batch_call(pointer);
+
+    return xxfunction->add
     (
         xxoverload,
         {
             xxoverload,
             handler_function_call(pointer),
+            handler_function_raw_call(pointer),
+            handler_function_raw_call<true>(pointer),
+            std::move(xxbatch),
+            handler_raw_object(pointer),
             detail::function_argument_types(dirty_pointer{}),
+            detail::function_pointer_arguments(dirty_pointer{}),
             detail::function_return_type(dirty_pointer{}),
             pointer
         }
     );
-
-    return xxmeta;
 }
 
 template <typename DirtyPropertyType = void, typename GetterType, typename SetterType>
@@ -310,6 +371,17 @@ property_t* find_or_add_property(reflection_t* reflection, std::string const& na
             handler_property_get(ipointer),
             handler_property_set(opointer),
             handler_property_context(ipointer),
+            handler_property_raw_get(ipointer),
+            handler_property_raw_set(opointer),
+            handler_property_raw_set<true>(opointer),
+            handler_property_raw_context(ipointer),
+            handler_property_raw_batch_get(ipointer),
+            handler_property_raw_batch_set(opointer),
+            handler_raw_object(ipointer),
+            property_offset(ipointer),
+            property_size(ipointer),
+            property_alignment(ipointer),
+            property_plain(ipointer),
             property_pointer(ipointer, opointer)
         }
     );
@@ -332,7 +404,8 @@ deleter_t* find_or_add_deleter(reflection_t* reflection)
         xxname,
         {
             xxname,
-            handler_deleter_call(pointer{})
+            handler_deleter_call(pointer{}),
+            handler_deleter_raw_call(pointer{})
         }
     );
 
@@ -3,8 +3,18 @@
 
 #include <string> // string
 #include <unordered_map> // unordered_map
+#include <vector> // vector
 #include <typeindex> // type_index
+#include <new> // placement new
+#include <stdexcept> // logic_error
+#include <mutex> // unique_lock
+#include <shared_mutex> // shared_mutex
 
+#include <Eightrefl/Name.hpp>
+#include <Eightrefl/MemoryUsage.hpp>
+#include <Eightrefl/Lock.hpp>
+#include <Eightrefl/Arena.hpp>
+#include <Eightrefl/Profiler.hpp>
 #include <Eightrefl/Type.hpp>
 #include <Eightrefl/Reflection.hpp>
 
@@ -15,9 +25,33 @@
 namespace eightrefl
 {
 
+namespace detail
+{
+
+// process-wide index, that every registry publishes its types into
+extern void publish_type(type_t* type);
+extern void unpublish_type(type_t* type);
+
+} // namespace detail
+
+// returns next dense type id, ids start from 0 and are unique across all registries
+extern std::size_t next_type_id();
+
+// returns count of ids issued so far, any issued id is less than it
+extern std::size_t type_id_count();
+
 struct registry_t
 {
-    std::unordered_map<std::string, type_t*> all;
+    // keys view interned names, iteration is not synchronized, so it should not run concurrently with add,
+    // key is hashed_name_t rather than std::string, its text is key.name
+    std::unordered_map<hashed_name_t, type_t*, hashed_name_t::hasher> all;
+    name_index_t<type_t> frozen_index;
+
+    // [name, evaluate] of not yet evaluated types, evaluate is nullptr while evaluation is in flight,
+    // keys view interned names, so miss is checked without allocation
+    mutable std::unordered_map<hashed_name_t, void(*)(), hashed_name_t::hasher> deferred;
+
+    arena_t arena; // owns memory of all metadata of registry
 
     #ifdef EIGHTREFL_RTTI_ALL_ENABLE
     std::unordered_map<std::type_index, type_t*> rtti_all;
@@ -25,25 +59,82 @@ struct registry_t
     registry_t();
     ~registry_t();
 
+    // types are owned by arena of registry, and other types refer to them, so registry is never copied
+    registry_t(registry_t const&) = delete;
+    registry_t& operator=(registry_t const&) = delete;
+
+    // lookup by name does not allocate, and does not hash, if name was hashed before,
+    // takes shared lock, so it may run concurrently with add, but readers still contend on lock,
+    // frozen registry is read without lock, misses included
+    type_t* find(hashed_name_t const& name) const;
     type_t* find(std::string const& name) const;
+    type_t* find(char const* name) const;
     #ifdef EIGHTREFL_RTTI_ALL_ENABLE
     type_t* find(std::type_index typeindex) const;
     #endif // EIGHTREFL_RTTI_ALL_ENABLE
 
+    // approximate bytes held by metadata of all types, should not run concurrently with registration
+    memory_usage_t memory_usage() const;
+
+    // postpones evaluation of reflection until type is first found by name, evaluation runs once,
+    // throws std::logic_error, if registry is frozen
+    void defer(std::string const& name, void(*evaluate)());
+
+    // evaluates all postponed reflections, e.g. before iteration over all
+    void evaluate_deferred();
+
+    // adds flat name indices for types and all their attributes, that are looked up without lock,
+    // frozen registry and its attributes reject new types and items until thaw,
+    // neither freeze nor thaw may run concurrently with other access, freeze evaluates deferred reflections
+    void freeze();
+    void thaw();
+    bool frozen() const;
+
     template <typename ReflectableType, typename DirtyReflectableType = ReflectableType>
     type_t* add(std::string const& name)
     {
-        auto& type = all[name];
-        if (type != nullptr) return type;
+        #ifdef EIGHTREFL_PROFILER_ENABLE
+        profile_add_t xxprofile;
+        #endif // EIGHTREFL_PROFILER_ENABLE
 
-        type = new type_t
+        std::unique_lock<std::shared_mutex> lock(shared_mutex_of(this));
+
+        hashed_name_t key(name);
+
+        auto it = all.find(key);
+        if (it != all.end()) return it->second;
+
+        if (is_frozen) throw std::logic_error("eightrefl::registry_t: add to frozen registry");
+
+        auto atom = intern(name);
+
+        auto type = new (arena.allocate(sizeof(type_t), alignof(type_t))) type_t
         {
             name,
-            new reflection_t { name },
+            atom,
+            add_reflection(name),
             this,
+            next_type_id(),
             type_size<ReflectableType>(),
-            handler_type_context<ReflectableType>()
+            type_alignment<ReflectableType>(),
+            handler_type_context<ReflectableType>(),
+            handler_type_raw_context<DirtyReflectableType>(),
+            handler_type_copy<ReflectableType>(),
+            handler_type_move<ReflectableType>(),
+            handler_type_destroy<ReflectableType>(),
+            handler_type_assign<DirtyReflectableType>(),
+            handler_type_pointee<DirtyReflectableType>()
         };
+        type->injection.arena = &arena;
+
+        // key views interned text, that outlives registry
+        all.emplace(hashed_name_t(atom.name(), key.hash), type);
+
+        detail::publish_type(type);
+
+        #ifdef EIGHTREFL_PROFILER_ENABLE
+        profiler()->add_type(this);
+        #endif // EIGHTREFL_PROFILER_ENABLE
 
         #ifdef EIGHTREFL_RTTI_ALL_ENABLE
         auto& rtti_type = rtti_all[typeid(ReflectableType)];
@@ -56,10 +147,24 @@ struct registry_t
         #endif // EIGHTREFL_RTTI_ALL_ENABLE
         return type;
     }
+
+private:
+    reflection_t* add_reflection(std::string const& name);
+    type_t* find_deferred(hashed_name_t const& name) const;
+
+    bool is_frozen = false;
 };
 
 extern registry_t* global();
 
+// finds type by name in any registry, or only in owner registry, if any,
+// types of one name are probed in order of registration, so builtin and standard types come first,
+// on miss deferred reflections of name are evaluated
+extern type_t* find_any(hashed_name_t const& name, registry_t const* owner = nullptr);
+
+// all types with name across registries, in order of registration, deferred reflections of name are evaluated first
+extern std::vector<type_t*> find_all(hashed_name_t const& name);
+
 } // namespace eightrefl
 
 #endif // EIGHTREFL_REGISTRY_HPP
@@ -0,0 +1,55 @@
+#ifndef EIGHTREFL_RESOLVER_HPP
+#define EIGHTREFL_RESOLVER_HPP
+
+#include <cstddef> // size_t
+
+#include <string> // string
+#include <vector> // vector
+#include <unordered_map> // unordered_map
+
+#include <Eightrefl/Attribute.hpp>
+
+namespace eightrefl
+{
+
+struct type_t;
+struct reflection_t;
+struct function_t;
+
+// runtime overload resolution by argument types, winner is cached per overloads and argument types,
+// so cache should be cleared if overloads was changed after resolving
+struct resolver_t
+{
+    // rank of argument conversion, lower is better
+    static constexpr std::size_t exact = 0;
+    static constexpr std::size_t adjust = 1; // bind to reference or pointer, or load from it
+    static constexpr std::size_t promotion = 2;
+    static constexpr std::size_t conversion = 3;
+    static constexpr std::size_t derived = 4; // plus distance to base
+    static constexpr std::size_t npos = std::size_t(-1);
+
+    static std::size_t rank(type_t* parameter, type_t* argument);
+
+    // pointer parameter accepts only pointers, unlike reference, that shares type_t with it
+    static std::size_t rank(type_t* parameter, type_t* argument, bool pointer);
+
+    // returns nullptr if there is no viable overload or best one is ambiguous
+    function_t* resolve(attribute_t<function_t> const* overloads, std::vector<type_t*> const& arguments);
+    function_t* resolve(reflection_t* reflection, std::string const& name, std::vector<type_t*> const& arguments);
+
+    void clear();
+
+private:
+    struct entry_t
+    {
+        attribute_t<function_t> const* overloads = nullptr;
+        std::vector<type_t*> arguments;
+        function_t* function = nullptr;
+    };
+
+    std::unordered_map<std::size_t, std::vector<entry_t>> cache;
+};
+
+} // namespace eightrefl
+
+#endif // EIGHTREFL_RESOLVER_HPP
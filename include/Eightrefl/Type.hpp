@@ -6,8 +6,13 @@
 #include <string> // string
 #include <any> // any
 #include <functional> // function
+#include <memory> // addressof
+#include <utility> // move
+#include <new> // placement new
+#include <type_traits> // is_copy_constructible_v, is_nothrow_move_constructible_v, is_pointer_v, is_array_v
 
 #include <Eightrefl/Attribute.hpp>
+#include <Eightrefl/Utility.hpp>
 
 namespace eightrefl
 {
@@ -15,14 +20,27 @@ namespace eightrefl
 struct reflection_t;
 struct registry_t;
 struct injection_t;
+struct type_t;
+
+template <typename DirtyReflectableType>
+type_t* find_type();
 
 struct type_t
 {
     std::string const name;
+    atom_t const atom; // interned name
     reflection_t* const reflection = nullptr;
     registry_t* const registry = nullptr;
+    std::size_t const id = 0; // dense per process, shared by all registries
     std::size_t const size = 0;
+    std::size_t const alignment = 0;
     std::function<std::any(std::any& object)> const context = nullptr;
+    void* (*const raw_context)(std::any const& object) = nullptr; // address of held object, nullptr if object holds other type
+    void (*const copy)(void* storage, void* object) = nullptr;
+    void (*const move)(void* storage, void* object) = nullptr; // nullptr, if move constructor may throw
+    void (*const destroy)(void* object) = nullptr;
+    void (*const assign)(std::any& object, void* value) = nullptr; // moves value into object, held object of the same type is copy assigned in place
+    type_t* (*const pointee)() = nullptr;
 
     attribute_t<injection_t> injection;
 };
@@ -49,6 +67,28 @@ template <> inline auto handler_type_context<void>()
     return nullptr;
 }
 
+template <typename ReflectableType>
+auto handler_type_raw_context()
+{
+    return [](std::any const& object) -> void*
+    {
+        return const_cast<ReflectableType*>(std::any_cast<ReflectableType>(&object));
+    };
+}
+
+template <> inline auto handler_type_raw_context<std::any>()
+{
+    return [](std::any const& object) -> void*
+    {
+        return const_cast<std::any*>(std::addressof(object));
+    };
+}
+
+template <> inline auto handler_type_raw_context<void>()
+{
+    return nullptr;
+}
+
 template <typename ReflectableType>
 auto type_size()
 {
@@ -60,6 +100,125 @@ template <> inline auto type_size<void>()
     return std::size_t(0);
 }
 
+template <typename ReflectableType>
+auto type_alignment()
+{
+    return alignof(ReflectableType);
+}
+
+template <> inline auto type_alignment<void>()
+{
+    return std::size_t(0);
+}
+
+template <typename ReflectableType>
+auto handler_type_copy()
+{
+    if constexpr (std::is_copy_constructible_v<ReflectableType> && !std::is_array_v<ReflectableType>
+                  && !meta::is_initializer_list<ReflectableType>::value)
+    {
+        return [](void* storage, void* object)
+        {
+            ::new (storage) ReflectableType(*static_cast<ReflectableType*>(object));
+        };
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+template <> inline auto handler_type_copy<void>()
+{
+    return nullptr;
+}
+
+template <typename ReflectableType>
+auto handler_type_move()
+{
+    if constexpr (std::is_nothrow_move_constructible_v<ReflectableType> && !std::is_array_v<ReflectableType>
+                  && !meta::is_initializer_list<ReflectableType>::value)
+    {
+        return [](void* storage, void* object)
+        {
+            ::new (storage) ReflectableType(std::move(*static_cast<ReflectableType*>(object)));
+        };
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+template <> inline auto handler_type_move<void>()
+{
+    return nullptr;
+}
+
+template <typename ReflectableType>
+auto handler_type_destroy()
+{
+    if constexpr (std::is_destructible_v<ReflectableType> && !std::is_array_v<ReflectableType>)
+    {
+        return [](void* object)
+        {
+            static_cast<ReflectableType*>(object)->~ReflectableType();
+        };
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+template <> inline auto handler_type_destroy<void>()
+{
+    return nullptr;
+}
+
+template <typename ReflectableType>
+auto handler_type_assign()
+{
+    if constexpr (std::is_copy_constructible_v<ReflectableType> && !std::is_array_v<ReflectableType>)
+    {
+        return [](std::any& object, void* value)
+        {
+            auto xxvalue = static_cast<ReflectableType*>(value);
+
+            // held object is copy assigned, so it keeps its buffer, e.g. std::string keeps its capacity
+            if (std::any_cast<ReflectableType>(&object) != nullptr) utility::assign<ReflectableType>(object, *xxvalue);
+            else utility::assign<ReflectableType>(object, std::move(*xxvalue));
+        };
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+template <> inline auto handler_type_assign<void>()
+{
+    return nullptr;
+}
+
+// pointed type is found lazily, since it may be not registered yet
+template <typename DirtyReflectableType>
+auto handler_type_pointee()
+{
+    using pointee_type = std::remove_pointer_t<DirtyReflectableType>;
+    if constexpr (std::is_pointer_v<DirtyReflectableType> && !std::is_function_v<pointee_type>)
+    {
+        return []
+        {
+            return find_type<pointee_type>();
+        };
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
 } // namespace eightrefl
 
 #endif // EIGHTREFL_TYPE_HPP
@@ -0,0 +1,60 @@
+#ifndef EIGHTREFL_TYPE_TABLE_HPP
+#define EIGHTREFL_TYPE_TABLE_HPP
+
+#include <cstddef> // size_t
+
+#include <vector> // vector
+#include <optional> // optional
+#include <utility> // forward
+
+#include <Eightrefl/Type.hpp>
+#include <Eightrefl/Registry.hpp>
+
+namespace eightrefl
+{
+
+// per type side table, indexed by type_t::id instead of hashing type_t*,
+// e.g. for serializer or script binding caches
+template <typename ValueType>
+struct type_table_t
+{
+    type_table_t() { all.reserve(type_id_count()); }
+
+    ValueType* find(type_t const* type)
+    {
+        if (type->id >= all.size() || !all[type->id].has_value()) return nullptr;
+        return &*all[type->id];
+    }
+
+    ValueType const* find(type_t const* type) const
+    {
+        if (type->id >= all.size() || !all[type->id].has_value()) return nullptr;
+        return &*all[type->id];
+    }
+
+    // replaces old value, if any
+    template <typename... ArgumentTypes>
+    ValueType* add(type_t const* type, ArgumentTypes&&... arguments)
+    {
+        if (type->id >= all.size()) all.resize(type->id + 1);
+        return &all[type->id].emplace(std::forward<ArgumentTypes>(arguments)...);
+    }
+
+    // default constructs missing value
+    ValueType& operator[](type_t const* type)
+    {
+        auto value = find(type);
+        return value != nullptr ? *value : *add(type);
+    }
+
+    void remove(type_t const* type)
+    {
+        if (type->id < all.size()) all[type->id].reset();
+    }
+
+    std::vector<std::optional<ValueType>> all;
+};
+
+} // namespace eightrefl
+
+#endif // EIGHTREFL_TYPE_TABLE_HPP
@@ -1,14 +1,82 @@
 #ifndef EIGHTREFL_UTILITY_HPP
 #define EIGHTREFL_UTILITY_HPP
 
+#include <cstddef> // size_t
+
 #include <any> // any
 #include <memory> // addressof
+#include <new> // placement new
+#include <utility> // forward, move
+#include <type_traits> // is_reference_v, is_pointer_v, is_function_v, is_same_v, is_assignable_v
 
 #include <Eightrefl/Detail/Meta.hpp>
 
 namespace eightrefl
 {
 
+// result of checked call, that reports mismatch instead of throwing
+enum class call_status_t
+{
+    success,
+    not_callable, // handler is not available, e.g. setter of readonly property
+    context_mismatch,
+    argument_count_mismatch,
+    argument_type_mismatch,
+    result_not_assignable // result type can not be held by std::any, e.g. array
+};
+
+// view of objects for batch calls, i-th object is placed at data + i * stride,
+// or is pointed by pointer placed at that address, if indirect
+struct batch_t
+{
+    void* data = nullptr;
+    std::size_t count = 0;
+    std::size_t stride = 0;
+    bool indirect = false;
+
+    void* operator[](std::size_t index) const
+    {
+        auto address = static_cast<char*>(data) + index * stride;
+        return indirect ? *reinterpret_cast<void**>(address) : address;
+    }
+};
+
+template <typename ReflectableType>
+batch_t batch_of(ReflectableType* objects, std::size_t count, std::size_t stride = sizeof(ReflectableType))
+{
+    return { const_cast<std::remove_const_t<ReflectableType>*>(objects), count, stride, false };
+}
+
+template <typename ReflectableType>
+batch_t batch_of(ReflectableType** objects, std::size_t count)
+{
+    return { objects, count, sizeof(ReflectableType*), true };
+}
+
+template <typename ReflectableType>
+batch_t batch_of(ReflectableType* const* objects, std::size_t count)
+{
+    return { const_cast<ReflectableType**>(objects), count, sizeof(ReflectableType*), true };
+}
+
+// object of context for member handlers, nullptr if context holds other type
+template <typename ReflectableType, typename MemberType>
+auto handler_raw_object(MemberType ReflectableType::*)
+{
+    return [](std::any const& context) -> void*
+    {
+        auto object = std::any_cast<ReflectableType*>(&context);
+        return object != nullptr ? *object : nullptr;
+    };
+}
+
+// free function and static property have no context
+template <typename PointerType>
+auto handler_raw_object(PointerType)
+{
+    return nullptr;
+}
+
 inline namespace utility
 {
 
@@ -46,6 +114,132 @@ std::any backward(ValueType&& result)
     }
 }
 
+// into calling convention: result is written into object, that may be reused between calls,
+// held value of the same type is assigned in place, e.g. std::string keeps its capacity
+template <typename ValueType, typename ResultType>
+void assign(std::any& object, ResultType&& result)
+{
+    if constexpr (std::is_pointer_v<ValueType> && std::is_function_v<std::remove_pointer_t<ValueType>>)
+    {
+        object = static_cast<ValueType>(result);
+    }
+    else if constexpr (std::is_reference_v<ValueType> || std::is_pointer_v<ValueType>)
+    {
+        object = utility::backward<ValueType>(static_cast<ValueType>(result));
+    }
+    else if constexpr (std::is_same_v<typename meta::to_reflectable_object<ValueType>::type, std::any>)
+    {
+        object = std::forward<ResultType>(result);
+    }
+    else
+    {
+        using reflectable = typename meta::to_reflectable_object<ValueType>::type;
+        if constexpr (std::is_assignable_v<reflectable&, ResultType&&>)
+        {
+            auto held = std::any_cast<reflectable>(&object);
+            if (held != nullptr)
+            {
+                *held = std::forward<ResultType>(result);
+                return;
+            }
+        }
+        object.emplace<reflectable>(std::forward<ResultType>(result));
+    }
+}
+
+// raw calling convention: object points to the reflectable form of ValueType,
+// i.e. to T* for references and pointers, and to T for values
+template <typename ValueType>
+ValueType forward(void* object)
+{
+    if constexpr (std::is_reference_v<ValueType>)
+    {
+        return **static_cast<typename meta::to_reflectable_reference<ValueType>::type*>(object);
+    }
+    else if constexpr (std::is_pointer_v<ValueType>)
+    {
+        return *static_cast<typename meta::to_reflectable_pointer<ValueType>::type*>(object);
+    }
+    else
+    {
+        return *static_cast<typename meta::to_reflectable_object<ValueType>::type*>(object);
+    }
+}
+
+// raw calling convention: lvalue, that is bound to ValueType parameter, owned value is neither copied nor moved here
+template <typename ValueType>
+auto& lvalue(void* object)
+{
+    if constexpr (std::is_reference_v<ValueType>)
+    {
+        return **static_cast<typename meta::to_reflectable_reference<ValueType>::type*>(object);
+    }
+    else if constexpr (std::is_pointer_v<ValueType>)
+    {
+        return *static_cast<typename meta::to_reflectable_pointer<ValueType>::type*>(object);
+    }
+    else
+    {
+        return *static_cast<typename meta::to_reflectable_object<ValueType>::type*>(object);
+    }
+}
+
+// raw calling convention: owned value is moved out of object, references and pointers are forwarded as is
+template <typename ValueType>
+ValueType release(void* object)
+{
+    if constexpr (std::is_reference_v<ValueType> || std::is_pointer_v<ValueType>)
+    {
+        return utility::forward<ValueType>(object);
+    }
+    else
+    {
+        return std::move(*static_cast<typename meta::to_reflectable_object<ValueType>::type*>(object));
+    }
+}
+
+// raw calling convention: owned value is moved out of object, if MoveValue, and is copied otherwise
+template <typename ValueType, bool MoveValue>
+ValueType pass(void* object)
+{
+    if constexpr (MoveValue)
+    {
+        return utility::release<ValueType>(object);
+    }
+    else
+    {
+        return utility::forward<ValueType>(object);
+    }
+}
+
+// raw calling convention: result points to uninitialized storage for the reflectable form of ValueType,
+// result may be nullptr to discard value
+template <typename ValueType>
+void backward(void* result, ValueType&& value)
+{
+    if (result == nullptr) return;
+
+    if constexpr (std::is_reference_v<ValueType>)
+    {
+        using pointer = typename meta::to_reflectable_reference<ValueType>::type;
+        ::new (result) pointer(const_cast<pointer>(std::addressof(value)));
+    }
+    else if constexpr (std::is_pointer_v<ValueType> && std::is_function_v<std::remove_pointer_t<ValueType>>)
+    {
+        ::new (result) ValueType(value);
+    }
+    else if constexpr (std::is_pointer_v<ValueType>)
+    {
+        using pointer = typename meta::to_reflectable_pointer<ValueType>::type;
+        ::new (result) pointer(const_cast<pointer>(value));
+    }
+    else
+    {
+        using object = typename meta::to_reflectable_object<ValueType>::type;
+        ::new (result) object(std::forward<ValueType>(value));
+    }
+}
+
 } // inline namespace utility
 
 } // namespace eightrefl
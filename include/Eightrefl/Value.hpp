@@ -0,0 +1,201 @@
+#ifndef EIGHTREFL_VALUE_HPP
+#define EIGHTREFL_VALUE_HPP
+
+#include <cstddef> // size_t, max_align_t
+#include <new> // operator new, operator delete, align_val_t
+#include <utility> // forward
+#include <stdexcept> // logic_error
+
+#include <Eightrefl/Type.hpp>
+
+#ifndef EIGHTREFL_VALUE_CAPACITY
+    #define EIGHTREFL_VALUE_CAPACITY std::size_t(4 * sizeof(void*))
+#endif // EIGHTREFL_VALUE_CAPACITY
+
+#ifndef EIGHTREFL_VALUE_ALIGNMENT
+    #define EIGHTREFL_VALUE_ALIGNMENT alignof(std::max_align_t)
+#endif // EIGHTREFL_VALUE_ALIGNMENT
+
+namespace eightrefl
+{
+
+template <typename ReflectableType>
+type_t* type_of();
+
+// type-erased object holder, that identifies held object by type_t* and keeps it in place,
+// if it fits to CapacityValue and AlignmentValue and has nothrow move constructor, otherwise in heap,
+// copy of value, that holds not copy constructible object, throws std::logic_error
+template <std::size_t CapacityValue = EIGHTREFL_VALUE_CAPACITY, std::size_t AlignmentValue = EIGHTREFL_VALUE_ALIGNMENT>
+struct basic_value_t
+{
+    static_assert(CapacityValue > 0 && AlignmentValue > 0);
+
+    static constexpr auto capacity = CapacityValue;
+    static constexpr auto alignment = AlignmentValue;
+
+    basic_value_t() = default;
+
+    basic_value_t(basic_value_t const& other)
+    {
+        copy_from(other);
+    }
+
+    basic_value_t(basic_value_t&& other) noexcept
+    {
+        move_from(other);
+    }
+
+    basic_value_t& operator=(basic_value_t const& other)
+    {
+        // held object is kept, if copy throws
+        if (this != &other) *this = basic_value_t(other);
+        return *this;
+    }
+
+    basic_value_t& operator=(basic_value_t&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            move_from(other);
+        }
+        return *this;
+    }
+
+    ~basic_value_t()
+    {
+        reset();
+    }
+
+    template <typename ValueType, typename... ArgumentTypes>
+    ValueType& emplace(ArgumentTypes&&... arguments)
+    {
+        auto storage = emplace(type_of<ValueType>(), [&arguments...](void* storage)
+        {
+            ::new (storage) ValueType(std::forward<ArgumentTypes>(arguments)...);
+        });
+        return *static_cast<ValueType*>(storage);
+    }
+
+    // constructor should create object of type in given storage, storage is nullptr for void type
+    // e.g. [&](void* storage) { function->raw_call(context, arguments, storage); },
+    // storage of held object is reused, if it has the same type, so repeated calls do not allocate
+    template <typename ConstructorType>
+    void* emplace(type_t* type, ConstructorType&& constructor)
+    {
+        void* storage = nullptr;
+        if (held != nullptr && held == type)
+        {
+            if (held->destroy != nullptr) held->destroy(object);
+            storage = object;
+
+            held = nullptr;
+            object = nullptr;
+        }
+        else
+        {
+            reset();
+        }
+
+        if (type == nullptr || type->size == 0)
+        {
+            constructor(nullptr);
+            return nullptr;
+        }
+
+        if (storage == nullptr) storage = allocate(type);
+
+        try { constructor(storage); }
+        catch (...) { deallocate(type, storage); throw; }
+
+        held = type;
+        object = storage;
+        return storage;
+    }
+
+    void reset()
+    {
+        if (held == nullptr) return;
+
+        if (held->destroy != nullptr) held->destroy(object);
+        deallocate(held, object);
+
+        held = nullptr;
+        object = nullptr;
+    }
+
+    template <typename ValueType>
+    ValueType* cast() const
+    {
+        return held != nullptr && held == type_of<ValueType>() ? static_cast<ValueType*>(object) : nullptr;
+    }
+
+    type_t* type() const { return held; }
+    void* data() const { return object; }
+
+    bool has_value() const { return held != nullptr; }
+    bool is_inline() const { return object == buffer; }
+
+private:
+    static bool fits(type_t* type)
+    {
+        return type->size <= CapacityValue && type->alignment <= AlignmentValue && type->move != nullptr;
+    }
+
+    void* allocate(type_t* type)
+    {
+        if (fits(type)) return buffer;
+        return ::operator new(type->size, std::align_val_t(type->alignment));
+    }
+
+    void deallocate(type_t* type, void* storage)
+    {
+        if (storage == buffer) return;
+        ::operator delete(storage, std::align_val_t(type->alignment));
+    }
+
+    void copy_from(basic_value_t const& other)
+    {
+        if (other.held == nullptr) return;
+        if (other.held->copy == nullptr) throw std::logic_error("eightrefl::value_t: held object is not copy constructible");
+
+        emplace(other.held, [&other](void* storage)
+        {
+            other.held->copy(storage, other.object);
+        });
+    }
+
+    // inline object has nothrow move constructor, and heap object is taken by pointer, so move does not throw
+    void move_from(basic_value_t& other) noexcept
+    {
+        if (other.held == nullptr) return;
+
+        if (other.is_inline())
+        {
+            emplace(other.held, [&other](void* storage)
+            {
+                other.held->move(storage, other.object);
+            });
+            other.reset();
+        }
+        else
+        {
+            held = other.held;
+            object = other.object;
+
+            other.held = nullptr;
+            other.object = nullptr;
+        }
+    }
+
+private:
+    alignas(AlignmentValue) unsigned char buffer[CapacityValue];
+    type_t* held = nullptr;
+    void* object = nullptr;
+};
+
+using value_t = basic_value_t<>;
+
+} // namespace eightrefl
+
+#endif // EIGHTREFL_VALUE_HPP
@@ -0,0 +1,31 @@
+#ifdef EIGHTREFL_PROFILER_ENABLE
+// replaces global operator new and delete to count allocations for profiler,
+// built as separate EightreflAllocationHook object target, that application links explicitly, e.g. into executable
+#include <Eightrefl/Profiler.hpp>
+
+#include <cstdlib> // malloc, free
+#include <new> // bad_alloc
+
+static void* eightrefl_profiled_new(std::size_t size)
+{
+    auto& counter = eightrefl::detail::profile_counter();
+    if (!counter.paused)
+    {
+        ++counter.allocation_count;
+        counter.allocation_size += size;
+    }
+
+    auto pointer = std::malloc(size == 0 ? 1 : size);
+    if (pointer == nullptr) throw std::bad_alloc();
+
+    return pointer;
+}
+
+void* operator new(std::size_t size) { return eightrefl_profiled_new(size); }
+void* operator new[](std::size_t size) { return eightrefl_profiled_new(size); }
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { std::free(pointer); }
+#endif // EIGHTREFL_PROFILER_ENABLE
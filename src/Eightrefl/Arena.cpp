@@ -0,0 +1,64 @@
+#include <Eightrefl/Arena.hpp>
+
+#include <cstdint> // uintptr_t
+
+#include <new> // operator new, operator delete
+
+namespace eightrefl
+{
+
+arena_t::~arena_t()
+{
+    for (auto const& block : blocks) ::operator delete(block.data);
+}
+
+void* arena_t::allocate(std::size_t size, std::size_t alignment)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto align = [alignment](char* pointer)
+    {
+        auto address = reinterpret_cast<std::uintptr_t>(pointer);
+        return pointer + ((alignment - address % alignment) % alignment);
+    };
+
+    used_size += size;
+
+    auto pointer = align(top);
+    if (top == nullptr || pointer + size > end)
+    {
+        // oversized allocation gets its own block, so current block is kept
+        auto block_size = size + alignment > this->block_size ? size + alignment : this->block_size;
+        auto data = static_cast<char*>(::operator new(block_size));
+
+        blocks.push_back({ data, block_size });
+
+        if (block_size != this->block_size) return align(data);
+
+        top = data;
+        end = data + block_size;
+
+        pointer = align(top);
+    }
+
+    top = pointer + size;
+    return pointer;
+}
+
+std::size_t arena_t::capacity() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    std::size_t result = 0;
+    for (auto const& block : blocks) result += block.size;
+
+    return result;
+}
+
+std::size_t arena_t::used() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return used_size;
+}
+
+} // namespace eightrefl
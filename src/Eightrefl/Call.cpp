@@ -0,0 +1,189 @@
+#include <Eightrefl/Function.hpp>
+#include <Eightrefl/Factory.hpp>
+#include <Eightrefl/Property.hpp>
+#include <Eightrefl/Type.hpp>
+#include <Eightrefl/Value.hpp>
+
+#include <cstddef> // size_t
+#include <any> // bad_any_cast
+#include <functional> // bad_function_call
+
+namespace eightrefl
+{
+
+namespace
+{
+
+// raw view of std::any args, that are checked against expected types
+class raw_arguments_t
+{
+public:
+    static constexpr std::size_t inline_count = 8;
+
+    explicit raw_arguments_t(std::vector<type_t*> const& types) : types(types)
+    {
+        if (types.size() > inline_count)
+        {
+            heap_pointers.resize(types.size());
+        }
+    }
+
+    // args are used in place, so raw_move_call can move from owned values, and raw_call leaves them intact
+    call_status_t view(std::vector<std::any> const& args)
+    {
+        if (args.size() != types.size()) return call_status_t::argument_count_mismatch;
+
+        auto pointers = data();
+        for (std::size_t index = 0; index < types.size(); ++index)
+        {
+            auto type = types[index];
+
+            pointers[index] = type->raw_context != nullptr ? type->raw_context(args[index]) : nullptr;
+            if (pointers[index] == nullptr) return call_status_t::argument_type_mismatch;
+        }
+        return call_status_t::success;
+    }
+
+    void** data() { return heap_pointers.empty() ? inline_pointers : heap_pointers.data(); }
+
+private:
+    std::vector<type_t*> const& types;
+
+    void* inline_pointers[inline_count] = {};
+    std::vector<void*> heap_pointers;
+};
+
+// result of raw call is written into result, void call resets it,
+// call is skipped, if result type can not be held by std::any
+template <typename CallType>
+call_status_t raw_call_into(type_t* type, std::any& result, CallType const& call)
+{
+    auto is_void = type == nullptr || type->size == 0;
+    if (!is_void && type->assign == nullptr) return call_status_t::result_not_assignable;
+
+    value_t value;
+    value.emplace(type, call);
+
+    if (is_void) result.reset();
+    else type->assign(result, value.data());
+
+    return call_status_t::success;
+}
+
+void check(call_status_t status)
+{
+    if (status != call_status_t::success) throw std::bad_any_cast();
+}
+
+} // namespace
+
+std::any function_t::move_call(std::any const& context, std::vector<std::any>& args) const
+{
+    auto object = raw_object != nullptr ? raw_object(context) : nullptr;
+    if (raw_object != nullptr && object == nullptr) throw std::bad_any_cast();
+
+    raw_arguments_t xxarguments(arguments);
+    check(xxarguments.view(args));
+
+    std::any xxresult;
+    check(raw_call_into(result, xxresult, [&](void* storage) { raw_move_call(object, xxarguments.data(), storage); }));
+
+    return xxresult;
+}
+
+void function_t::call_into(std::any const& context, std::vector<std::any> const& args, std::any& result) const
+{
+    check(try_call(context, args, result));
+}
+
+call_status_t function_t::try_call(std::any const& context, std::vector<std::any> const& args, std::any& result) const
+{
+    if (raw_call == nullptr) return call_status_t::not_callable;
+
+    auto object = raw_object != nullptr ? raw_object(context) : nullptr;
+    if (raw_object != nullptr && object == nullptr) return call_status_t::context_mismatch;
+
+    raw_arguments_t xxarguments(arguments);
+
+    auto status = xxarguments.view(args);
+    if (status != call_status_t::success) return status;
+
+    return raw_call_into(this->result, result, [&](void* storage) { raw_call(object, xxarguments.data(), storage); });
+}
+
+std::any factory_t::move_call(std::vector<std::any>& args) const
+{
+    raw_arguments_t xxarguments(arguments);
+    check(xxarguments.view(args));
+
+    std::any xxresult;
+    check(raw_call_into(result, xxresult, [&](void* storage) { raw_move_call(xxarguments.data(), storage); }));
+
+    return xxresult;
+}
+
+void factory_t::call_into(std::vector<std::any> const& args, std::any& result) const
+{
+    check(try_call(args, result));
+}
+
+call_status_t factory_t::try_call(std::vector<std::any> const& args, std::any& result) const
+{
+    if (raw_call == nullptr) return call_status_t::not_callable;
+
+    raw_arguments_t xxarguments(arguments);
+
+    auto status = xxarguments.view(args);
+    if (status != call_status_t::success) return status;
+
+    return raw_call_into(this->result, result, [&](void* storage) { raw_call(xxarguments.data(), storage); });
+}
+
+void factory_t::construct_array_at(void* storage, std::size_t count, void* const* args) const
+{
+    auto objects = static_cast<char*>(storage);
+
+    std::size_t index = 0;
+    try
+    {
+        // raw_call leaves args intact, so they are shared by all objects
+        for (; index < count; ++index) raw_call(args, objects + index * result->size);
+    }
+    catch (...)
+    {
+        if (result->destroy != nullptr)
+        {
+            while (index > 0) result->destroy(objects + --index * result->size);
+        }
+        throw;
+    }
+}
+
+void property_t::move_set(std::any const& context, std::any& value) const
+{
+    if (raw_move_set == nullptr) throw std::bad_function_call();
+
+    auto object = raw_object != nullptr ? raw_object(context) : nullptr;
+    if (raw_object != nullptr && object == nullptr) throw std::bad_any_cast();
+
+    auto xxvalue = type->raw_context != nullptr ? type->raw_context(value) : nullptr;
+    if (xxvalue == nullptr) throw std::bad_any_cast();
+
+    raw_move_set(object, xxvalue);
+}
+
+call_status_t property_t::try_set(std::any const& context, std::any const& value) const
+{
+    if (raw_set == nullptr) return call_status_t::not_callable;
+
+    auto object = raw_object != nullptr ? raw_object(context) : nullptr;
+    if (raw_object != nullptr && object == nullptr) return call_status_t::context_mismatch;
+
+    auto xxvalue = type->raw_context != nullptr ? type->raw_context(value) : nullptr;
+    if (xxvalue == nullptr) return call_status_t::argument_type_mismatch;
+
+    raw_set(object, xxvalue);
+    return call_status_t::success;
+}
+
+} // namespace eightrefl
@@ -0,0 +1,95 @@
+#include <Eightrefl/CallSite.hpp>
+
+#include <utility> // move
+
+#include <Eightrefl/Type.hpp>
+#include <Eightrefl/Reflection.hpp>
+#include <Eightrefl/Function.hpp>
+#include <Eightrefl/Parent.hpp>
+
+namespace eightrefl
+{
+
+namespace detail
+{
+
+static function_t* call_site_function(reflection_t* reflection, std::string const& name, std::string const& signature)
+{
+    auto overloads = reflection->function.find(name);
+    if (overloads == nullptr) return nullptr;
+
+    if (!signature.empty()) return overloads->find(signature);
+    return overloads->all.size() == 1 ? overloads->all.begin()->second : nullptr;
+}
+
+// function of type or of its parents, path is filled by parents on the way
+static function_t* call_site_lookup(type_t* type, std::string const& name, std::string const& signature,
+                                    std::vector<parent_t*>& path)
+{
+    function_t* function = nullptr;
+    walk_parents(type, path, [&name, &signature, &function](type_t* type)
+    {
+        if (type->reflection != nullptr) function = call_site_function(type->reflection, name, signature);
+        return function != nullptr;
+    });
+    return function;
+}
+
+} // namespace detail
+
+void* call_site_t::target_t::cast(void* context) const
+{
+    for (auto parent : path) context = parent->raw_cast(context);
+    return context;
+}
+
+std::any call_site_t::target_t::cast(std::any const& context) const
+{
+    auto result = context;
+    for (auto parent : path) result = parent->cast(result);
+    return result;
+}
+
+bool call_site_t::raw_call(type_t* type, void* context, void* const* arguments, void* result)
+{
+    auto target = find(type);
+    if (target == nullptr) return false;
+
+    target->function->raw_call(target->cast(context), arguments, result);
+    return true;
+}
+
+call_status_t call_site_t::call(type_t* type, std::any const& context, std::vector<std::any> const& arguments,
+                                std::any& result)
+{
+    auto target = find(type);
+    if (target == nullptr) return call_status_t::not_callable;
+
+    return target->function->try_call(target->cast(context), arguments, result);
+}
+
+void call_site_t::clear()
+{
+    for (auto& target : cache) target = {};
+    next = 0;
+}
+
+call_site_t::target_t const* call_site_t::lookup(type_t* type)
+{
+    // misses are not cached, since function may be added to receiver later
+    std::vector<parent_t*> path;
+
+    auto function = detail::call_site_lookup(type, name, signature, path);
+    if (function == nullptr) return nullptr;
+
+    auto& target = cache[next];
+    next = (next + 1) % EIGHTREFL_CALL_SITE_CACHE_SIZE;
+
+    target.type = type;
+    target.function = function;
+    target.path = std::move(path);
+
+    return &target;
+}
+
+} // namespace eightrefl
@@ -0,0 +1,29 @@
+#include <Eightrefl/Delegate.hpp>
+
+#include <Eightrefl/Type.hpp>
+#include <Eightrefl/CallSite.hpp>
+
+namespace eightrefl
+{
+
+delegate_t bind(type_t* type, void* object, std::string const& name, std::string const& signature)
+{
+    call_site_t site(name, signature);
+
+    auto target = site.find(type);
+    if (target == nullptr) return {};
+
+    return { target->function, target->cast(object) };
+}
+
+delegate_t bind(type_t* type, std::any& object, std::string const& name, std::string const& signature)
+{
+    if (type == nullptr || type->raw_context == nullptr) return {};
+
+    auto context = type->raw_context(object);
+    if (context == nullptr) return {};
+
+    return bind(type, context, name, signature);
+}
+
+} // namespace eightrefl
@@ -4,6 +4,7 @@
 #include <Eightrefl/Dev/Registry.hpp>
 #include <Eightrefl/Dev/Injection.hpp>
 #include <Eightrefl/Dev/Attribute.hpp>
+#include <Eightrefl/Dev/Name.hpp>
 
 #include <Eightrefl/Standard/string.hpp>
 #include <Eightrefl/Standard/any.hpp>
@@ -11,10 +12,19 @@
 
 REFLECTABLE(eightrefl::type_t)
     PROPERTY(name)
+    PROPERTY(atom)
     PROPERTY(reflection)
     PROPERTY(registry)
+    PROPERTY(id)
     PROPERTY(size)
+    PROPERTY(alignment)
     PROPERTY(context)
+    PROPERTY(raw_context)
+    PROPERTY(copy)
+    PROPERTY(move)
+    PROPERTY(destroy)
+    PROPERTY(assign)
+    PROPERTY(pointee)
     PROPERTY(injection)
 REFLECTABLE_INIT()
 #endif // EIGHTREFL_DEV_ENABLE
@@ -0,0 +1,12 @@
+#ifdef EIGHTREFL_DEV_ENABLE
+#include <Eightrefl/Dev/Batch.hpp>
+
+#include <Eightrefl/BuiltIn/Core.hpp>
+
+REFLECTABLE(eightrefl::batch_t)
+    PROPERTY(data)
+    PROPERTY(count)
+    PROPERTY(stride)
+    PROPERTY(indirect)
+REFLECTABLE_INIT()
+#endif // EIGHTREFL_DEV_ENABLE
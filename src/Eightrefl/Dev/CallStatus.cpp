@@ -0,0 +1,12 @@
+#ifdef EIGHTREFL_DEV_ENABLE
+#include <Eightrefl/Dev/CallStatus.hpp>
+
+REFLECTABLE(eightrefl::call_status_t)
+    META("success", eightrefl::call_status_t::success)
+    META("not_callable", eightrefl::call_status_t::not_callable)
+    META("context_mismatch", eightrefl::call_status_t::context_mismatch)
+    META("argument_count_mismatch", eightrefl::call_status_t::argument_count_mismatch)
+    META("argument_type_mismatch", eightrefl::call_status_t::argument_type_mismatch)
+    META("result_not_assignable", eightrefl::call_status_t::result_not_assignable)
+REFLECTABLE_INIT()
+#endif // EIGHTREFL_DEV_ENABLE
@@ -10,6 +10,7 @@
 REFLECTABLE(eightrefl::deleter_t)
     PROPERTY(name)
     PROPERTY(call)
+    PROPERTY(raw_call)
     PROPERTY(meta)
 REFLECTABLE_INIT()
 #endif // EIGHTREFL_DEV_ENABLE
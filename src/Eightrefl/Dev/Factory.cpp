@@ -1,6 +1,7 @@
 #ifdef EIGHTREFL_DEV_ENABLE
 #include <Eightrefl/Dev/Factory.hpp>
 #include <Eightrefl/Dev/Type.hpp>
+#include <Eightrefl/Dev/CallStatus.hpp>
 #include <Eightrefl/Dev/Meta.hpp>
 #include <Eightrefl/Dev/Attribute.hpp>
 
@@ -12,8 +13,13 @@
 REFLECTABLE(eightrefl::factory_t)
     PROPERTY(name)
     PROPERTY(call)
+    PROPERTY(raw_call)
+    PROPERTY(raw_move_call)
     PROPERTY(arguments)
     PROPERTY(result)
     PROPERTY(meta)
+    FUNCTION(move_call)
+    FUNCTION(call_into)
+    FUNCTION(try_call)
 REFLECTABLE_INIT()
 #endif // EIGHTREFL_DEV_ENABLE
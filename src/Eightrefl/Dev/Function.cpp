@@ -1,6 +1,8 @@
 #ifdef EIGHTREFL_DEV_ENABLE
 #include <Eightrefl/Dev/Function.hpp>
 #include <Eightrefl/Dev/Type.hpp>
+#include <Eightrefl/Dev/Batch.hpp>
+#include <Eightrefl/Dev/CallStatus.hpp>
 #include <Eightrefl/Dev/Meta.hpp>
 #include <Eightrefl/Dev/Attribute.hpp>
 
@@ -12,9 +14,17 @@
 REFLECTABLE(eightrefl::function_t)
     PROPERTY(name)
     PROPERTY(call)
+    PROPERTY(raw_call)
+    PROPERTY(raw_move_call)
+    PROPERTY(raw_batch_call)
+    PROPERTY(raw_object)
     PROPERTY(arguments)
+    PROPERTY(pointer_arguments)
     PROPERTY(result)
     PROPERTY(pointer)
     PROPERTY(meta)
+    FUNCTION(move_call)
+    FUNCTION(call_into)
+    FUNCTION(try_call)
 REFLECTABLE_INIT()
 #endif // EIGHTREFL_DEV_ENABLE
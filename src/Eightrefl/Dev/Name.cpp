@@ -0,0 +1,20 @@
+#ifdef EIGHTREFL_DEV_ENABLE
+#include <Eightrefl/Dev/Name.hpp>
+
+#include <Eightrefl/BuiltIn/Core.hpp>
+
+#include <Eightrefl/Standard/string.hpp>
+
+REFLECTABLE(eightrefl::atom_t)
+    PROPERTY(id)
+REFLECTABLE_INIT()
+
+REFLECTABLE(eightrefl::hashed_name_t)
+    FACTORY(R(std::string const&))
+    PROPERTY(hash)
+REFLECTABLE_INIT()
+
+REFLECTABLE(eightrefl::hashed_name_t::hasher)
+    FUNCTION(operator())
+REFLECTABLE_INIT()
+#endif // EIGHTREFL_DEV_ENABLE
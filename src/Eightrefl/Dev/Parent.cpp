@@ -12,6 +12,7 @@ REFLECTABLE(eightrefl::parent_t)
     PROPERTY(name)
     PROPERTY(type)
     PROPERTY(cast)
+    PROPERTY(raw_cast)
     PROPERTY(meta)
 REFLECTABLE_INIT()
 #endif // EIGHTREFL_DEV_ENABLE
\ No newline at end of file
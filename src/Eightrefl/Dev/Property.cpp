@@ -1,6 +1,8 @@
 #ifdef EIGHTREFL_DEV_ENABLE
 #include <Eightrefl/Dev/Property.hpp>
 #include <Eightrefl/Dev/Type.hpp>
+#include <Eightrefl/Dev/Batch.hpp>
+#include <Eightrefl/Dev/CallStatus.hpp>
 #include <Eightrefl/Dev/Meta.hpp>
 #include <Eightrefl/Dev/Attribute.hpp>
 
@@ -15,6 +17,19 @@ REFLECTABLE(eightrefl::property_t)
     PROPERTY(get)
     PROPERTY(set)
     PROPERTY(context)
+    PROPERTY(raw_get)
+    PROPERTY(raw_set)
+    PROPERTY(raw_move_set)
+    PROPERTY(raw_context)
+    PROPERTY(raw_batch_get)
+    PROPERTY(raw_batch_set)
+    PROPERTY(raw_object)
+    PROPERTY(offset)
+    PROPERTY(size)
+    PROPERTY(alignment)
+    PROPERTY(plain)
     PROPERTY(meta)
+    FUNCTION(move_set)
+    FUNCTION(try_set)
 REFLECTABLE_INIT()
 #endif // EIGHTREFL_DEV_ENABLE
@@ -1,6 +1,7 @@
 #ifdef EIGHTREFL_DEV_ENABLE
 #include <Eightrefl/Dev/Registry.hpp>
 #include <Eightrefl/Dev/Type.hpp>
+#include <Eightrefl/Dev/Name.hpp>
 
 #include <Eightrefl/Standard/string.hpp>
 
@@ -18,6 +19,10 @@ REFLECTABLE(eightrefl::registry_t)
     FUNCTION(find, eightrefl::type_t*(std::type_index) const)
     #endif // EIGHTREFL_RTTI_ALL_ENABLE
 
+    FUNCTION(evaluate_deferred)
+    FUNCTION(freeze)
+    FUNCTION(thaw)
+    FUNCTION(frozen)
     PROPERTY(all)
 
     #ifdef EIGHTREFL_RTTI_ALL_ENABLE
@@ -0,0 +1,165 @@
+#ifdef EIGHTREFL_EXECUTOR_ENABLE
+#include <Eightrefl/Executor.hpp>
+
+#include <functional> // hash
+#include <exception> // current_exception
+#include <utility> // move
+#include <optional> // optional, nullopt
+
+#include <Eightrefl/Function.hpp>
+#include <Eightrefl/Factory.hpp>
+
+namespace eightrefl
+{
+
+executor_t::executor_t(std::size_t size)
+{
+    if (size == 0) size = 1;
+
+    workers.reserve(size);
+    for (std::size_t index = 0; index < size; ++index) workers.push_back(std::make_unique<worker_t>());
+
+    // workers are started after all of them are created, since any worker may steal from others
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        workers[index]->thread = std::thread([this, index] { work(index); });
+    }
+}
+
+executor_t::~executor_t()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+        stop = true;
+    }
+    sleep.notify_all();
+
+    for (auto& worker : workers) worker->thread.join();
+}
+
+std::future<std::any> executor_t::submit(function_t const* function, std::any const& context,
+                                         std::vector<std::any>&& arguments, void const* strand)
+{
+    task_t task;
+    task.function = function;
+    task.context = context;
+    task.arguments = std::move(arguments);
+
+    return push(std::move(task), strand);
+}
+
+std::future<std::any> executor_t::submit(factory_t const* factory, std::vector<std::any>&& arguments)
+{
+    task_t task;
+    task.factory = factory;
+    task.arguments = std::move(arguments);
+
+    return push(std::move(task), nullptr);
+}
+
+void executor_t::task_t::run()
+{
+    try
+    {
+        if (function != nullptr) promise.set_value(function->move_call(context, arguments));
+        else promise.set_value(factory->move_call(arguments));
+    }
+    catch (...)
+    {
+        promise.set_exception(std::current_exception());
+    }
+}
+
+std::future<std::any> executor_t::push(task_t&& task, void const* strand)
+{
+    auto future = task.promise.get_future();
+
+    auto index = strand != nullptr ? std::hash<void const*>{}(strand) % workers.size() : next++ % workers.size();
+    auto& worker = *workers[index];
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        (strand != nullptr ? worker.pinned : worker.shared).push_back(std::move(task));
+
+        // counter is published under sleep lock, so waiting worker does not miss it
+        std::lock_guard<std::mutex> sleep_lock(sleep_mutex);
+        ++(strand != nullptr ? worker.pinned_count : shared_count);
+    }
+    sleep.notify_all();
+
+    return future;
+}
+
+std::optional<executor_t::task_t> executor_t::pop(std::size_t index)
+{
+    auto& self = *workers[index];
+    {
+        std::lock_guard<std::mutex> lock(self.mutex);
+        if (!self.pinned.empty())
+        {
+            auto task = std::move(self.pinned.front());
+            self.pinned.pop_front();
+            --self.pinned_count;
+            return task;
+        }
+        if (!self.shared.empty())
+        {
+            auto task = std::move(self.shared.front());
+            self.shared.pop_front();
+            --shared_count;
+            return task;
+        }
+    }
+
+    // steals the most recently submitted call from the back of other worker
+    for (std::size_t offset = 1; offset < workers.size(); ++offset)
+    {
+        auto& other = *workers[(index + offset) % workers.size()];
+
+        std::lock_guard<std::mutex> lock(other.mutex);
+        if (!other.shared.empty())
+        {
+            auto task = std::move(other.shared.back());
+            other.shared.pop_back();
+            --shared_count;
+            return task;
+        }
+    }
+    return std::nullopt;
+}
+
+void executor_t::work(std::size_t index)
+{
+    auto& self = *workers[index];
+    while (true)
+    {
+        auto task = pop(index);
+        if (task)
+        {
+            task->run();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        sleep.wait(lock, [this, &self] { return stop || shared_count > 0 || self.pinned_count > 0; });
+
+        if (stop && shared_count == 0 && self.pinned_count == 0) return;
+    }
+}
+
+executor_t* executor()
+{
+    static executor_t self; return &self;
+}
+
+std::future<std::any> function_t::call_async(std::any const& context, std::vector<std::any> args, void const* strand) const
+{
+    return executor()->submit(this, context, std::move(args), strand);
+}
+
+std::future<std::any> factory_t::call_async(std::vector<std::any> args) const
+{
+    return executor()->submit(this, std::move(args));
+}
+
+} // namespace eightrefl
+#endif // EIGHTREFL_EXECUTOR_ENABLE
@@ -0,0 +1,33 @@
+#include <Eightrefl/Lock.hpp>
+
+#include <cstddef> // size_t
+#include <cstdint> // uintptr_t
+
+namespace eightrefl
+{
+
+namespace
+{
+
+struct alignas(64) lock_shard_t
+{
+    std::shared_mutex mutex;
+};
+
+} // namespace
+
+std::recursive_mutex& registration_mutex()
+{
+    static std::recursive_mutex self; return self;
+}
+
+std::shared_mutex& shared_mutex_of(void const* address)
+{
+    static lock_shard_t shards[EIGHTREFL_LOCK_SHARD_COUNT];
+
+    // low bits are zero due to alignment
+    auto key = reinterpret_cast<std::uintptr_t>(address) >> 4;
+    return shards[(key ^ (key >> 7)) % EIGHTREFL_LOCK_SHARD_COUNT].mutex;
+}
+
+} // namespace eightrefl
@@ -0,0 +1,185 @@
+#include <Eightrefl/MemoryUsage.hpp>
+
+#include <string> // string
+#include <functional> // function
+#include <utility> // pair
+#include <type_traits> // is_same_v, remove_const_t
+
+#include <Eightrefl/Registry.hpp>
+#include <Eightrefl/Injection.hpp>
+#include <Eightrefl/Parent.hpp>
+#include <Eightrefl/Factory.hpp>
+#include <Eightrefl/Function.hpp>
+#include <Eightrefl/Property.hpp>
+#include <Eightrefl/Deleter.hpp>
+#include <Eightrefl/Meta.hpp>
+
+namespace eightrefl
+{
+
+namespace
+{
+
+constexpr auto handler_size = sizeof(std::function<void()>);
+
+template <typename> constexpr bool is_handler = false;
+template <typename SignatureType> constexpr bool is_handler<std::function<SignatureType>> = true;
+
+// counts std::function members of metadata, all members should be listed,
+// so new member, that is missed here, breaks build instead of estimation
+template <class MetaType, typename... MemberTypes>
+constexpr std::size_t handler_count_of(MemberTypes MetaType::*...)
+{
+    constexpr auto size = (sizeof(MemberTypes) + ... + std::size_t(0));
+    static_assert(size <= sizeof(MetaType) && sizeof(MetaType) - size < alignof(MetaType), "unlisted member of metadata");
+
+    return (std::size_t(is_handler<std::remove_const_t<MemberTypes>>) + ... + std::size_t(0));
+}
+
+template <class MetaType> constexpr std::size_t handler_count = 0;
+
+template <> constexpr std::size_t handler_count<type_t> = handler_count_of<type_t>
+(
+    &type_t::name, &type_t::atom, &type_t::reflection, &type_t::registry, &type_t::id, &type_t::size, &type_t::alignment,
+    &type_t::context, &type_t::raw_context, &type_t::copy, &type_t::move, &type_t::destroy, &type_t::assign, &type_t::pointee,
+    &type_t::injection
+);
+
+template <> constexpr std::size_t handler_count<parent_t> = handler_count_of<parent_t>
+(
+    &parent_t::name, &parent_t::type, &parent_t::cast, &parent_t::raw_cast, &parent_t::meta
+);
+
+template <> constexpr std::size_t handler_count<factory_t> = handler_count_of<factory_t>
+(
+    &factory_t::name, &factory_t::call, &factory_t::raw_call, &factory_t::raw_move_call, &factory_t::arguments, &factory_t::result, &factory_t::meta
+);
+
+template <> constexpr std::size_t handler_count<function_t> = handler_count_of<function_t>
+(
+    &function_t::name, &function_t::call, &function_t::raw_call, &function_t::raw_move_call, &function_t::raw_batch_call,
+    &function_t::raw_object,
+    &function_t::arguments, &function_t::pointer_arguments, &function_t::result, &function_t::pointer, &function_t::meta
+);
+
+template <> constexpr std::size_t handler_count<property_t> = handler_count_of<property_t>
+(
+    &property_t::name, &property_t::type, &property_t::get, &property_t::set, &property_t::context,
+    &property_t::raw_get, &property_t::raw_set, &property_t::raw_move_set, &property_t::raw_context,
+    &property_t::raw_batch_get, &property_t::raw_batch_set,
+    &property_t::raw_object, &property_t::offset, &property_t::size, &property_t::alignment, &property_t::plain,
+    &property_t::pointer, &property_t::meta
+);
+
+template <> constexpr std::size_t handler_count<deleter_t> = handler_count_of<deleter_t>
+(
+    &deleter_t::name, &deleter_t::call, &deleter_t::raw_call, &deleter_t::meta
+);
+
+template <> constexpr std::size_t handler_count<injection_t> = handler_count_of<injection_t>
+(
+    &injection_t::name, &injection_t::type, &injection_t::call
+);
+
+std::size_t string_usage(std::string const& string)
+{
+    static auto const small_capacity = std::string().capacity();
+    return string.capacity() > small_capacity ? string.capacity() + 1 : 0;
+}
+
+// node keeps next pointer, value and cached hash
+template <class MapType>
+std::size_t map_usage(MapType const& map)
+{
+    using node = std::pair<typename MapType::key_type const, typename MapType::mapped_type>;
+    return map.bucket_count() * sizeof(void*) + map.size() * (sizeof(void*) + sizeof(node) + sizeof(std::size_t));
+}
+
+template <typename ValueType>
+std::size_t name_index_usage(name_index_t<ValueType> const& index)
+{
+    return index.entries.capacity() * sizeof(typename name_index_t<ValueType>::entry_t)
+         + index.names.capacity() * sizeof(std::string_view);
+}
+
+template <class MetaType>
+void attribute_usage(attribute_t<MetaType> const& attribute, std::size_t& bytes, memory_usage_t& usage)
+{
+    bytes += map_usage(attribute.all) + name_index_usage(attribute.frozen_index);
+
+    for (auto const& [name, item] : attribute.all)
+    {
+        bytes += sizeof(MetaType) - handler_count<MetaType> * handler_size;
+
+        usage.handler += handler_count<MetaType> * handler_size;
+        usage.name += string_usage(item->name);
+
+        if constexpr (std::is_same_v<MetaType, function_t> || std::is_same_v<MetaType, factory_t>)
+        {
+            bytes += item->arguments.capacity() * sizeof(type_t*);
+        }
+
+        if constexpr (std::is_same_v<MetaType, function_t>)
+        {
+            bytes += item->pointer_arguments.capacity() * sizeof(std::size_t);
+        }
+
+        if constexpr (!std::is_same_v<MetaType, injection_t>)
+        {
+            attribute_usage(item->meta, usage.meta, usage);
+        }
+    }
+}
+
+void function_usage(attribute_t<attribute_t<function_t>> const& function, memory_usage_t& usage)
+{
+    usage.function += map_usage(function.all) + name_index_usage(function.frozen_index);
+
+    for (auto const& [name, overloads] : function.all)
+    {
+        usage.function += sizeof(attribute_t<function_t>);
+
+        attribute_usage(*overloads, usage.function, usage);
+    }
+}
+
+} // namespace
+
+memory_usage_t registry_t::memory_usage() const
+{
+    memory_usage_t usage;
+
+    usage.arena_slack += arena.capacity() - arena.used();
+    usage.atom_pool += atom_pool_usage();
+
+    usage.index += map_usage(all) + name_index_usage(frozen_index) + map_usage(deferred);
+
+    #ifdef EIGHTREFL_RTTI_ALL_ENABLE
+    usage.rtti_all += map_usage(rtti_all);
+    #endif // EIGHTREFL_RTTI_ALL_ENABLE
+
+    for (auto const& [name, type] : all)
+    {
+        usage.type += sizeof(type_t) - handler_count<type_t> * handler_size;
+        usage.handler += handler_count<type_t> * handler_size;
+        usage.name += string_usage(type->name);
+
+        attribute_usage(type->injection, usage.injection, usage);
+
+        auto reflection = type->reflection;
+
+        usage.reflection += sizeof(reflection_t);
+        usage.name += string_usage(reflection->name);
+
+        attribute_usage(reflection->parent, usage.parent, usage);
+        attribute_usage(reflection->factory, usage.factory, usage);
+        function_usage(reflection->function, usage);
+        attribute_usage(reflection->property, usage.property, usage);
+        attribute_usage(reflection->deleter, usage.deleter, usage);
+        attribute_usage(reflection->meta, usage.meta, usage);
+    }
+
+    return usage;
+}
+
+} // namespace eightrefl
@@ -0,0 +1,125 @@
+#include <Eightrefl/Name.hpp>
+
+#include <cstddef> // size_t
+
+#include <string> // string
+#include <unordered_map> // unordered_map
+#include <utility> // pair
+#include <mutex> // mutex, lock_guard
+#include <atomic> // atomic
+#include <stdexcept> // length_error
+
+namespace eightrefl
+{
+
+namespace
+{
+
+// names are stored in chunks, that are never moved nor freed, so name of issued atom is read without lock
+struct atom_pool_t
+{
+    static constexpr std::size_t chunk_size = 1024;
+    static constexpr std::size_t chunk_count = 4096;
+
+    atom_pool_t() { emplace(std::string_view()); }
+
+    ~atom_pool_t()
+    {
+        for (auto& chunk : chunks) delete[] chunk.load(std::memory_order_relaxed);
+    }
+
+    // should be called under lock
+    std::uint32_t emplace(std::string_view name)
+    {
+        auto id = size;
+        if (id / chunk_size >= chunk_count) throw std::length_error("eightrefl: too many interned names");
+
+        auto& chunk = chunks[id / chunk_size];
+        if (chunk.load(std::memory_order_relaxed) == nullptr)
+        {
+            chunk.store(new std::string[chunk_size], std::memory_order_release);
+        }
+
+        auto& text = chunk.load(std::memory_order_relaxed)[id % chunk_size];
+        text = name;
+
+        ids.emplace(text, static_cast<std::uint32_t>(id));
+        ++size;
+
+        return static_cast<std::uint32_t>(id);
+    }
+
+    std::string_view name(std::uint32_t id) const
+    {
+        return chunks[id / chunk_size].load(std::memory_order_acquire)[id % chunk_size];
+    }
+
+    // should be called under lock
+    std::size_t usage() const
+    {
+        static auto const small_capacity = std::string().capacity();
+
+        std::size_t bytes = sizeof(atom_pool_t);
+        for (std::size_t id = 0; id < size; ++id)
+        {
+            if (id % chunk_size == 0) bytes += chunk_size * sizeof(std::string);
+
+            auto const& text = chunks[id / chunk_size].load(std::memory_order_relaxed)[id % chunk_size];
+            if (text.capacity() > small_capacity) bytes += text.capacity() + 1;
+        }
+
+        using node = std::pair<std::string_view const, std::uint32_t>;
+        bytes += ids.bucket_count() * sizeof(void*) + ids.size() * (sizeof(void*) + sizeof(node) + sizeof(std::size_t));
+
+        return bytes;
+    }
+
+    std::mutex mutex;
+    std::atomic<std::string*> chunks[chunk_count] = {};
+    std::size_t size = 0;
+    std::unordered_map<std::string_view, std::uint32_t> ids; // views names
+};
+
+atom_pool_t& atom_pool()
+{
+    static atom_pool_t self; return self;
+}
+
+} // namespace
+
+std::string_view atom_t::name() const
+{
+    return atom_pool().name(id);
+}
+
+atom_t intern(std::string_view name)
+{
+    auto& pool = atom_pool();
+
+    std::lock_guard<std::mutex> lock(pool.mutex);
+
+    auto it = pool.ids.find(name);
+    if (it != pool.ids.end()) return { it->second };
+
+    return { pool.emplace(name) };
+}
+
+atom_t find_atom(std::string_view name)
+{
+    auto& pool = atom_pool();
+
+    std::lock_guard<std::mutex> lock(pool.mutex);
+
+    auto it = pool.ids.find(name);
+    return it != pool.ids.end() ? atom_t{ it->second } : atom_t{};
+}
+
+std::size_t atom_pool_usage()
+{
+    auto& pool = atom_pool();
+
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    return pool.usage();
+}
+
+} // namespace eightrefl
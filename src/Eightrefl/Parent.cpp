@@ -0,0 +1,25 @@
+#include <Eightrefl/Parent.hpp>
+
+#include <Eightrefl/Type.hpp>
+#include <Eightrefl/Reflection.hpp>
+
+namespace eightrefl
+{
+
+bool walk_parents(type_t* type, std::vector<parent_t*>& path, std::function<bool(type_t* type)> const& visit)
+{
+    if (type == nullptr) return false;
+    if (visit(type)) return true;
+
+    if (type->reflection == nullptr) return false;
+
+    for (auto const& [name, parent] : type->reflection->parent.all)
+    {
+        path.push_back(parent);
+        if (walk_parents(parent->type, path, visit)) return true;
+        path.pop_back();
+    }
+    return false;
+}
+
+} // namespace eightrefl
@@ -0,0 +1,177 @@
+#include <Eightrefl/Path.hpp>
+
+#include <utility> // move
+
+#include <Eightrefl/Type.hpp>
+#include <Eightrefl/Reflection.hpp>
+#include <Eightrefl/Parent.hpp>
+#include <Eightrefl/Function.hpp>
+#include <Eightrefl/Property.hpp>
+
+namespace eightrefl
+{
+
+namespace detail
+{
+
+static type_t* path_pointee(type_t* type)
+{
+    return type != nullptr && type->pointee != nullptr ? type->pointee() : nullptr;
+}
+
+static path_t::step_t& path_open_step(std::vector<path_t::step_t>& steps)
+{
+    if (steps.empty() || steps.back().hop != nullptr || steps.back().loads > 0) steps.emplace_back();
+    return steps.back();
+}
+
+static type_t* path_load(std::vector<path_t::step_t>& steps, type_t* type)
+{
+    for (auto pointee = path_pointee(type); pointee != nullptr; pointee = path_pointee(type))
+    {
+        if (steps.empty()) steps.emplace_back();
+        ++steps.back().loads;
+        type = pointee;
+    }
+    return type;
+}
+
+// member of type or of its parents, parents are filled on the way
+static bool path_find_member(type_t* type, std::string const& name, std::vector<parent_t*>& parents,
+                             property_t*& property, function_t*& function)
+{
+    return walk_parents(type, parents, [&name, &property, &function](type_t* type)
+    {
+        if (type->reflection == nullptr) return false;
+
+        property = type->reflection->property.find(name);
+        if (property != nullptr) return true;
+
+        auto overloads = type->reflection->function.find(name);
+        if (overloads == nullptr) return false;
+
+        for (auto const& [signature, overload] : overloads->all)
+        {
+            if (overload->arguments.empty() && path_pointee(overload->result) != nullptr)
+            {
+                function = overload;
+                return true;
+            }
+        }
+        return false;
+    });
+}
+
+} // namespace detail
+
+void* path_t::context(void* object) const
+{
+    if (property == nullptr) return nullptr;
+
+    auto owner_context = owner(object);
+    if (owner_context == nullptr) return nullptr;
+
+    if (property->offset != property_t::npos) return static_cast<char*>(owner_context) + property->offset;
+    if (property->raw_context != nullptr) return property->raw_context(owner_context);
+
+    return nullptr;
+}
+
+bool path_t::raw_get(void* object, void* result) const
+{
+    if (property == nullptr || property->raw_get == nullptr) return false;
+
+    auto owner_context = owner(object);
+    if (owner_context == nullptr) return false;
+
+    property->raw_get(owner_context, result);
+    return true;
+}
+
+bool path_t::raw_set(void* object, void* value) const
+{
+    if (property == nullptr || property->raw_set == nullptr) return false;
+
+    auto owner_context = owner(object);
+    if (owner_context == nullptr) return false;
+
+    property->raw_set(owner_context, value);
+    return true;
+}
+
+path_t compile_path(type_t* type, std::string const& path)
+{
+    std::vector<path_t::step_t> steps;
+    auto current = detail::path_load(steps, type);
+
+    std::size_t begin = 0;
+    while (true)
+    {
+        auto end = path.find('.', begin);
+        auto name = path.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+
+        std::vector<parent_t*> parents;
+        property_t* property = nullptr;
+        function_t* function = nullptr;
+
+        if (!detail::path_find_member(current, name, parents, property, function)) return {};
+
+        for (auto parent : parents)
+        {
+            detail::path_open_step(steps).hop = [parent](void* context)
+            {
+                return parent->raw_cast(context);
+            };
+        }
+
+        if (end == std::string::npos)
+        {
+            if (property == nullptr) return {};
+            return { type, property, std::move(steps) };
+        }
+
+        if (function != nullptr)
+        {
+            detail::path_open_step(steps).hop = [function](void* context)
+            {
+                void* result = nullptr;
+                function->raw_call(context, nullptr, &result);
+                return result;
+            };
+            current = detail::path_pointee(function->result);
+        }
+        else if (property->offset != property_t::npos)
+        {
+            detail::path_open_step(steps).offset += property->offset;
+            current = property->type;
+        }
+        else if (detail::path_pointee(property->type) != nullptr && property->raw_get != nullptr)
+        {
+            // getter returns reference or pointer to next context
+            detail::path_open_step(steps).hop = [property](void* context)
+            {
+                void* result = nullptr;
+                property->raw_get(context, &result);
+                return result;
+            };
+            current = detail::path_pointee(property->type);
+        }
+        else if (property->raw_context != nullptr)
+        {
+            detail::path_open_step(steps).hop = [property](void* context)
+            {
+                return property->raw_context(context);
+            };
+            current = property->type;
+        }
+        else
+        {
+            return {};
+        }
+
+        current = detail::path_load(steps, current);
+        begin = end + 1;
+    }
+}
+
+} // namespace eightrefl
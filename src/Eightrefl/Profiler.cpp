@@ -0,0 +1,259 @@
+#ifdef EIGHTREFL_PROFILER_ENABLE
+#include <Eightrefl/Profiler.hpp>
+
+#include <algorithm> // sort, min
+#include <sstream> // ostringstream
+#include <iomanip> // setw
+
+#include <Eightrefl/Registry.hpp>
+#include <Eightrefl/BuiltIn/BuiltIn.hpp>
+#include <Eightrefl/Standard/Standard.hpp>
+
+#ifdef EIGHTREFL_DEV_ENABLE
+#include <Eightrefl/Dev/Dev.hpp>
+#endif // EIGHTREFL_DEV_ENABLE
+
+namespace eightrefl
+{
+
+namespace detail
+{
+
+// trivial, so it's safe to use from operator new at any time
+static thread_local profile_counter_t counter;
+static thread_local profile_scope_t* scope = nullptr;
+
+profile_counter_t& profile_counter()
+{
+    return counter;
+}
+
+static std::string registry_name(registry_t* registry)
+{
+    if (registry == global()) return "global";
+    if (registry == builtin()) return "builtin";
+    if (registry == standard()) return "standard";
+    #ifdef EIGHTREFL_DEV_ENABLE
+    if (registry == dev()) return "dev";
+    #endif // EIGHTREFL_DEV_ENABLE
+
+    std::ostringstream stream;
+    stream << "custom@" << static_cast<void const*>(registry);
+    return stream.str();
+}
+
+static std::string json_escape(std::string const& text)
+{
+    std::string result;
+    for (auto symbol : text)
+    {
+        if (symbol == '"' || symbol == '\\') result.push_back('\\');
+        result.push_back(symbol);
+    }
+    return result;
+}
+
+} // namespace detail
+
+void profiler_t::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    type.clear();
+    registry.clear();
+}
+
+std::vector<profile_t> profiler_t::top(std::size_t count) const
+{
+    std::vector<profile_t> result;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        result.reserve(type.size());
+        for (auto const& [name, profile] : type) result.push_back(profile);
+    }
+
+    std::sort(result.begin(), result.end(), [](auto const& lhs, auto const& rhs)
+    {
+        return lhs.time > rhs.time;
+    });
+
+    result.resize(std::min(count, result.size()));
+    return result;
+}
+
+std::string profiler_t::report(std::size_t count) const
+{
+    std::ostringstream stream;
+
+    stream << "registry" << '\n';
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto const& [key, profile] : registry)
+        {
+            stream << "  " << std::left << std::setw(24) << detail::registry_name(key) << std::right
+                   << " types: " << profile.type_count
+                   << " evaluations: " << profile.evaluation_count
+                   << " time(us): " << profile.time.count() / 1000
+                   << " add(us): " << profile.add_time.count() / 1000
+                   << " allocations: " << profile.allocation_count
+                   << " bytes: " << profile.allocation_size
+                   << " attributes: " << profile.attribute_count << '\n';
+        }
+    }
+
+    stream << "type" << '\n';
+    for (auto const& profile : top(count))
+    {
+        stream << "  " << std::setw(10) << profile.time.count() / 1000 << "us"
+               << std::setw(10) << profile.add_time.count() / 1000 << "us"
+               << std::setw(8) << profile.allocation_count
+               << std::setw(10) << profile.allocation_size << "b"
+               << std::setw(6) << profile.attribute_count
+               << "  " << profile.name << " [" << detail::registry_name(profile.registry) << "]" << '\n';
+    }
+
+    return stream.str();
+}
+
+std::string profiler_t::report_json(std::size_t count) const
+{
+    auto print = [](std::ostringstream& stream, profile_t const& profile)
+    {
+        stream << "{\"name\":\"" << detail::json_escape(profile.name) << "\""
+               << ",\"registry\":\"" << detail::json_escape(detail::registry_name(profile.registry)) << "\""
+               << ",\"time_ns\":" << profile.time.count()
+               << ",\"add_time_ns\":" << profile.add_time.count()
+               << ",\"evaluation_count\":" << profile.evaluation_count
+               << ",\"allocation_count\":" << profile.allocation_count
+               << ",\"allocation_size\":" << profile.allocation_size
+               << ",\"attribute_count\":" << profile.attribute_count
+               << ",\"type_count\":" << profile.type_count << "}";
+    };
+
+    std::ostringstream stream;
+
+    stream << "{\"registry\":[";
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto first = true;
+        for (auto const& [key, profile] : registry)
+        {
+            if (!first) stream << ",";
+            print(stream, profile);
+            first = false;
+        }
+    }
+
+    stream << "],\"type\":[";
+    {
+        auto first = true;
+        for (auto const& profile : top(count))
+        {
+            if (!first) stream << ",";
+            print(stream, profile);
+            first = false;
+        }
+    }
+    stream << "]}";
+
+    return stream.str();
+}
+
+void profiler_t::add(profile_t const& profile)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto& type_profile = type[profile.name];
+    type_profile.name = profile.name;
+    type_profile.registry = profile.registry;
+    type_profile.time += profile.time;
+    type_profile.add_time += profile.add_time;
+    type_profile.evaluation_count += profile.evaluation_count;
+    type_profile.allocation_count += profile.allocation_count;
+    type_profile.allocation_size += profile.allocation_size;
+    type_profile.attribute_count += profile.attribute_count;
+
+    auto& registry_profile = registry[profile.registry];
+    registry_profile.name = detail::registry_name(profile.registry);
+    registry_profile.registry = profile.registry;
+    registry_profile.time += profile.time;
+    registry_profile.add_time += profile.add_time;
+    registry_profile.evaluation_count += profile.evaluation_count;
+    registry_profile.allocation_count += profile.allocation_count;
+    registry_profile.allocation_size += profile.allocation_size;
+    registry_profile.attribute_count += profile.attribute_count;
+}
+
+void profiler_t::add_type(registry_t* registry)
+{
+    auto paused = detail::counter.paused;
+    detail::counter.paused = true;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto& registry_profile = this->registry[registry];
+        registry_profile.name = detail::registry_name(registry);
+        registry_profile.registry = registry;
+        ++registry_profile.type_count;
+    }
+    detail::counter.paused = paused;
+}
+
+profiler_t* profiler()
+{
+    static profiler_t self; return &self;
+}
+
+profile_scope_t::profile_scope_t(std::string name, registry_t* registry)
+    : name(std::move(name)), registry(registry), start(detail::counter), parent(detail::scope)
+{
+    detail::scope = this;
+    start_time = std::chrono::steady_clock::now();
+}
+
+profile_scope_t::~profile_scope_t()
+{
+    auto time = std::chrono::steady_clock::now() - start_time;
+    auto const& counter = detail::counter;
+
+    // inclusive cost
+    profile_t profile;
+    profile.time = std::chrono::duration_cast<std::chrono::nanoseconds>(time);
+    profile.add_time = counter.add_time - start.add_time;
+    profile.allocation_count = counter.allocation_count - start.allocation_count;
+    profile.allocation_size = counter.allocation_size - start.allocation_size;
+    profile.attribute_count = counter.attribute_count - start.attribute_count;
+
+    if (parent != nullptr)
+    {
+        parent->nested.time += profile.time;
+        parent->nested.add_time += profile.add_time;
+        parent->nested.allocation_count += profile.allocation_count;
+        parent->nested.allocation_size += profile.allocation_size;
+        parent->nested.attribute_count += profile.attribute_count;
+    }
+
+    detail::scope = parent;
+
+    // own cost
+    profile.name = std::move(name);
+    profile.registry = registry;
+    profile.time -= nested.time;
+    profile.add_time -= nested.add_time;
+    profile.evaluation_count = 1;
+    profile.allocation_count -= nested.allocation_count;
+    profile.allocation_size -= nested.allocation_size;
+    profile.attribute_count -= nested.attribute_count;
+
+    auto paused = detail::counter.paused;
+    detail::counter.paused = true;
+
+    profiler()->add(profile);
+
+    detail::counter.paused = paused;
+}
+
+} // namespace eightrefl
+#endif // EIGHTREFL_PROFILER_ENABLE
@@ -1,5 +1,8 @@
 #include <Eightrefl/Registry.hpp>
 
+#include <atomic> // atomic
+#include <algorithm> // remove, find_if
+
 #include <Eightrefl/Injection.hpp>
 #include <Eightrefl/Parent.hpp>
 #include <Eightrefl/Factory.hpp>
@@ -11,34 +14,351 @@
 namespace eightrefl
 {
 
+namespace
+{
+
+// types by atom id of their name, atoms are dense, so lookup is vector index
+struct type_catalog_t
+{
+    std::shared_mutex mutex;
+    std::vector<std::vector<type_t*>> all;
+    std::vector<std::vector<registry_t const*>> deferred; // registries, that defer name, by its atom id
+};
+
+type_catalog_t& type_catalog()
+{
+    static type_catalog_t self; return self;
+}
+
+void publish_deferred(registry_t const* registry, atom_t atom)
+{
+    auto& catalog = type_catalog();
+
+    std::unique_lock<std::shared_mutex> lock(catalog.mutex);
+    if (atom.id >= catalog.deferred.size()) catalog.deferred.resize(atom.id + 1);
+
+    catalog.deferred[atom.id].push_back(registry);
+}
+
+void unpublish_deferred(registry_t const* registry, atom_t atom)
+{
+    auto& catalog = type_catalog();
+
+    std::unique_lock<std::shared_mutex> lock(catalog.mutex);
+    if (atom.id >= catalog.deferred.size()) return;
+
+    auto& registries = catalog.deferred[atom.id];
+    registries.erase(std::remove(registries.begin(), registries.end(), registry), registries.end());
+}
+
+// evaluates deferred reflections of name, so they are published, registry does it on lookup
+void evaluate_deferred_of(hashed_name_t const& name, atom_t atom, registry_t const* owner)
+{
+    std::vector<registry_t const*> registries;
+    {
+        auto& catalog = type_catalog();
+
+        std::shared_lock<std::shared_mutex> lock(catalog.mutex);
+        if (atom.id >= catalog.deferred.size()) return;
+
+        registries = catalog.deferred[atom.id];
+    }
+
+    // catalog lock must be released, since evaluation publishes types
+    for (auto registry : registries)
+    {
+        if (owner == nullptr || registry == owner) registry->find(name);
+    }
+}
+
+type_t* find_published(atom_t atom, registry_t const* owner)
+{
+    auto& catalog = type_catalog();
+
+    std::shared_lock<std::shared_mutex> lock(catalog.mutex);
+    if (atom.id >= catalog.all.size()) return nullptr;
+
+    for (auto type : catalog.all[atom.id])
+    {
+        if (owner == nullptr || type->registry == owner) return type;
+    }
+    return nullptr;
+}
+
+} // namespace
+
 registry_t::registry_t()
 {
+    type_catalog(); // catalog should outlive registry
+    intern(std::string_view()); // atom pool should outlive registry, since keys of registry and attributes view it
     all.reserve(EIGHTREFL_REGISTRY_RESERVE_SIZE);
 }
 
 registry_t::~registry_t()
 {
+    for (auto& [name, evaluate] : deferred)
+    {
+        unpublish_deferred(this, find_atom(name.name));
+    }
+
+    // memory is owned by arena
     for (auto& [name, meta] : all)
     {
-        delete meta->reflection;
-        delete meta;
+        detail::unpublish_type(meta);
+
+        meta->reflection->~reflection_t();
+        meta->~type_t();
+    }
+}
+
+reflection_t* registry_t::add_reflection(std::string const& name)
+{
+    auto reflection = new (arena.allocate(sizeof(reflection_t), alignof(reflection_t))) reflection_t { name };
+
+    reflection->parent.arena = &arena;
+    reflection->factory.arena = &arena;
+    reflection->function.arena = &arena;
+    reflection->property.arena = &arena;
+    reflection->deleter.arena = &arena;
+    reflection->meta.arena = &arena;
+
+    return reflection;
+}
+
+type_t* registry_t::find(hashed_name_t const& name) const
+{
+    // frozen registry has no deferred entries, and nothing is added to it
+    if (is_frozen) return frozen_index.find(name);
+
+    {
+        std::shared_lock<std::shared_mutex> lock(shared_mutex_of(this));
+
+        auto it = all.find(name);
+        if (it != all.end()) return it->second;
+
+        // registration mutex is taken only for name, that is deferred
+        if (deferred.find(name) == deferred.end()) return nullptr;
+    }
+
+    return find_deferred(name);
+}
+
+type_t* registry_t::find_deferred(hashed_name_t const& name) const
+{
+    // concurrent lookup of the same name waits until evaluation is done
+    std::lock_guard<std::recursive_mutex> guard(registration_mutex());
+
+    void (*evaluate)() = nullptr;
+    {
+        std::unique_lock<std::shared_mutex> lock(shared_mutex_of(this));
+
+        auto it = deferred.find(name);
+
+        // entry is kept in flight, so concurrent lookup of the same name does not give up,
+        // in flight entry is seen here by evaluation itself only, e.g. on recursive lookup
+        if (it == deferred.end() || it->second == nullptr)
+        {
+            auto type = all.find(name);
+            return type != all.end() ? type->second : nullptr;
+        }
+
+        evaluate = it->second;
+        it->second = nullptr;
+    }
+
+    auto done = [this, &name]
+    {
+        std::unique_lock<std::shared_mutex> lock(shared_mutex_of(this));
+        deferred.erase(name);
+        unpublish_deferred(this, find_atom(name.name));
+    };
+
+    // evaluation registers type itself, so map lock must be released
+    try
+    {
+        evaluate();
     }
+    catch (...)
+    {
+        done();
+        throw;
+    }
+
+    done();
+    return find(name);
 }
 
 type_t* registry_t::find(std::string const& name) const
 {
-    auto it = all.find(name);
-    return it != all.end() ? it->second : nullptr;
+    return find(hashed_name_t(name));
+}
+
+type_t* registry_t::find(char const* name) const
+{
+    return find(hashed_name_t(name));
 }
 
 #ifdef EIGHTREFL_RTTI_ALL_ENABLE
 type_t* registry_t::find(std::type_index typeindex) const
 {
+    std::shared_lock<std::shared_mutex> lock(shared_mutex_of(this));
+
     auto it = rtti_all.find(typeindex);
     return it != rtti_all.end() ? it->second : nullptr;
 }
 #endif // EIGHTREFL_RTTI_ALL_ENABLE
 
+void registry_t::defer(std::string const& name, void(*evaluate)())
+{
+    std::unique_lock<std::shared_mutex> lock(shared_mutex_of(this));
+
+    hashed_name_t key(name);
+
+    if (all.find(key) != all.end()) return;
+    if (is_frozen) throw std::logic_error("eightrefl::registry_t: defer to frozen registry");
+
+    // key views interned text, that outlives registry
+    auto atom = intern(key.name);
+    if (deferred.emplace(hashed_name_t(atom.name(), key.hash), evaluate).second)
+    {
+        publish_deferred(this, atom);
+    }
+}
+
+void registry_t::evaluate_deferred()
+{
+    // waits for evaluations of other threads, so only in flight entries of caller itself may remain
+    std::lock_guard<std::recursive_mutex> guard(registration_mutex());
+
+    while (true)
+    {
+        hashed_name_t name;
+        {
+            std::shared_lock<std::shared_mutex> lock(shared_mutex_of(this));
+
+            auto it = std::find_if(deferred.begin(), deferred.end(), [](auto const& item) { return item.second != nullptr; });
+            if (it == deferred.end()) return;
+
+            name = it->first;
+        }
+
+        find_deferred(name);
+    }
+}
+
+void registry_t::freeze()
+{
+    evaluate_deferred();
+
+    for (auto& [name, type] : all)
+    {
+        auto reflection = type->reflection;
+
+        reflection->parent.freeze();
+        reflection->factory.freeze();
+        reflection->function.freeze();
+        reflection->property.freeze();
+        reflection->deleter.freeze();
+        reflection->meta.freeze();
+
+        type->injection.freeze();
+    }
+
+    frozen_index.build(all);
+    is_frozen = true;
+}
+
+void registry_t::thaw()
+{
+    for (auto& [name, type] : all)
+    {
+        auto reflection = type->reflection;
+
+        reflection->parent.thaw();
+        reflection->factory.thaw();
+        reflection->function.thaw();
+        reflection->property.thaw();
+        reflection->deleter.thaw();
+        reflection->meta.thaw();
+
+        type->injection.thaw();
+    }
+
+    if (!is_frozen) return;
+
+    frozen_index.clear();
+    is_frozen = false;
+}
+
+bool registry_t::frozen() const
+{
+    return is_frozen;
+}
+
+static std::atomic<std::size_t> type_id_counter{ 0 };
+
+std::size_t next_type_id()
+{
+    return type_id_counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::size_t type_id_count()
+{
+    return type_id_counter.load(std::memory_order_relaxed);
+}
+
+type_t* find_any(hashed_name_t const& name, registry_t const* owner)
+{
+    // deferred names are interned, so name without atom is neither published nor deferred
+    auto atom = find_atom(name.name);
+    if (atom == atom_t{} && !name.name.empty()) return nullptr;
+
+    auto type = find_published(atom, owner);
+    if (type != nullptr) return type;
+
+    evaluate_deferred_of(name, atom, owner);
+    return find_published(atom, owner);
+}
+
+std::vector<type_t*> find_all(hashed_name_t const& name)
+{
+    auto atom = find_atom(name.name);
+    if (atom == atom_t{} && !name.name.empty()) return {};
+
+    evaluate_deferred_of(name, atom, nullptr);
+
+    auto& catalog = type_catalog();
+
+    std::shared_lock<std::shared_mutex> lock(catalog.mutex);
+    return atom.id < catalog.all.size() ? catalog.all[atom.id] : std::vector<type_t*>{};
+}
+
+namespace detail
+{
+
+void publish_type(type_t* type)
+{
+    auto& catalog = type_catalog();
+
+    std::unique_lock<std::shared_mutex> lock(catalog.mutex);
+    if (type->atom.id >= catalog.all.size()) catalog.all.resize(type->atom.id + 1);
+
+    catalog.all[type->atom.id].push_back(type);
+}
+
+void unpublish_type(type_t* type)
+{
+    auto& catalog = type_catalog();
+
+    std::unique_lock<std::shared_mutex> lock(catalog.mutex);
+    if (type->atom.id >= catalog.all.size()) return;
+
+    auto& types = catalog.all[type->atom.id];
+    types.erase(std::remove(types.begin(), types.end(), type), types.end());
+}
+
+} // namespace detail
+
 registry_t* global()
 {
     static registry_t self; return &self;
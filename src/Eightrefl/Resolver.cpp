@@ -0,0 +1,201 @@
+#include <Eightrefl/Resolver.hpp>
+
+#include <algorithm> // find
+#include <functional> // hash
+#include <unordered_set> // unordered_set
+#include <utility> // pair, move
+
+#include <Eightrefl/Reflectable.hpp>
+
+#include <Eightrefl/BuiltIn/Core.hpp>
+
+namespace eightrefl
+{
+
+namespace detail
+{
+
+static bool is_arithmetic(type_t* type)
+{
+    static std::unordered_set<type_t*> const self
+    {
+        type_of<bool>(), type_of<char>(), type_of<wchar_t>(), type_of<char16_t>(), type_of<char32_t>(),
+        type_of<signed char>(), type_of<unsigned char>(), type_of<short>(), type_of<unsigned short>(),
+        type_of<int>(), type_of<unsigned int>(), type_of<long>(), type_of<unsigned long>(),
+        type_of<long long>(), type_of<unsigned long long>(), type_of<std_size_t>(), type_of<std_ptrdiff_t>(),
+        type_of<float>(), type_of<double>(), type_of<long double>()
+    };
+    return self.count(type) > 0;
+}
+
+static bool is_promotion(type_t* parameter, type_t* argument)
+{
+    static std::unordered_set<type_t*> const integral
+    {
+        type_of<bool>(), type_of<char>(), type_of<signed char>(), type_of<unsigned char>(),
+        type_of<short>(), type_of<unsigned short>()
+    };
+
+    if (parameter == type_of<int>()) return integral.count(argument) > 0;
+    if (parameter == type_of<double>()) return argument == type_of<float>();
+    return false;
+}
+
+// number of inheritance steps from derived to base, npos if base is not reachable
+static std::size_t base_distance(type_t* derived, type_t* base)
+{
+    if (base == nullptr) return resolver_t::npos;
+
+    auto distance = resolver_t::npos;
+
+    std::vector<parent_t*> path;
+    walk_parents(derived, path, [base, &path, &distance](type_t* type)
+    {
+        if (type == base && path.size() < distance) distance = path.size();
+        return distance == 0;
+    });
+    return distance;
+}
+
+static type_t* pointee_of(type_t* type)
+{
+    return type->pointee != nullptr ? type->pointee() : nullptr;
+}
+
+// -1 if lhs is better, 1 if rhs is better, 0 otherwise
+static int compare(std::vector<std::size_t> const& lhs, std::vector<std::size_t> const& rhs)
+{
+    auto lhs_better = false;
+    auto rhs_better = false;
+    for (std::size_t index = 0; index < lhs.size(); ++index)
+    {
+        if (lhs[index] < rhs[index]) lhs_better = true;
+        else if (rhs[index] < lhs[index]) rhs_better = true;
+    }
+    return lhs_better == rhs_better ? 0 : (lhs_better ? -1 : 1);
+}
+
+static std::size_t hash_of(attribute_t<function_t> const* overloads, std::vector<type_t*> const& arguments)
+{
+    auto hash = std::hash<void const*>{}(overloads);
+    for (auto argument : arguments)
+    {
+        hash ^= std::hash<void const*>{}(argument) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
+
+} // namespace detail
+
+std::size_t resolver_t::rank(type_t* parameter, type_t* argument)
+{
+    if (parameter == nullptr || argument == nullptr) return npos;
+    if (parameter == argument) return exact;
+
+    auto parameter_pointee = detail::pointee_of(parameter);
+    auto argument_pointee = detail::pointee_of(argument);
+
+    if (parameter_pointee == argument || argument_pointee == parameter) return adjust;
+
+    if (detail::is_arithmetic(parameter) && detail::is_arithmetic(argument))
+    {
+        return detail::is_promotion(parameter, argument) ? promotion : conversion;
+    }
+
+    if (parameter_pointee != nullptr && parameter_pointee == type_of<void>() && argument_pointee != nullptr)
+    {
+        return conversion;
+    }
+
+    auto distance = detail::base_distance(argument, parameter);
+    if (distance == npos) distance = detail::base_distance(argument, parameter_pointee);
+    if (distance == npos && argument_pointee != nullptr) distance = detail::base_distance(argument_pointee, parameter_pointee);
+
+    return distance == npos ? npos : derived + distance;
+}
+
+std::size_t resolver_t::rank(type_t* parameter, type_t* argument, bool pointer)
+{
+    if (!pointer) return rank(parameter, argument);
+
+    if (parameter == nullptr || argument == nullptr) return npos;
+    if (parameter == argument) return exact;
+
+    auto parameter_pointee = detail::pointee_of(parameter);
+    auto argument_pointee = detail::pointee_of(argument);
+
+    if (parameter_pointee == nullptr || argument_pointee == nullptr) return npos;
+    if (parameter_pointee == type_of<void>()) return conversion;
+
+    auto distance = detail::base_distance(argument_pointee, parameter_pointee);
+    return distance == npos ? npos : derived + distance;
+}
+
+function_t* resolver_t::resolve(attribute_t<function_t> const* overloads, std::vector<type_t*> const& arguments)
+{
+    if (overloads == nullptr) return nullptr;
+
+    auto& bucket = cache[detail::hash_of(overloads, arguments)];
+    for (auto const& entry : bucket)
+    {
+        if (entry.overloads == overloads && entry.arguments == arguments) return entry.function;
+    }
+
+    std::vector<std::pair<function_t*, std::vector<std::size_t>>> viable;
+    for (auto const& [signature, function] : overloads->all)
+    {
+        if (function->arguments.size() != arguments.size()) continue;
+
+        std::vector<std::size_t> ranks;
+        ranks.reserve(arguments.size());
+
+        auto const& pointers = function->pointer_arguments;
+        for (std::size_t index = 0; index < arguments.size(); ++index)
+        {
+            auto pointer = std::find(pointers.begin(), pointers.end(), index) != pointers.end();
+
+            auto argument_rank = rank(function->arguments[index], arguments[index], pointer);
+            if (argument_rank == npos) break;
+
+            ranks.push_back(argument_rank);
+        }
+
+        if (ranks.size() == arguments.size()) viable.emplace_back(function, std::move(ranks));
+    }
+
+    function_t* best = nullptr;
+    if (!viable.empty())
+    {
+        auto candidate = &viable.front();
+        for (auto& item : viable)
+        {
+            if (detail::compare(item.second, candidate->second) < 0) candidate = &item;
+        }
+
+        best = candidate->first;
+        for (auto& item : viable)
+        {
+            if (&item != candidate && detail::compare(candidate->second, item.second) >= 0)
+            {
+                best = nullptr;
+                break;
+            }
+        }
+    }
+
+    bucket.push_back({ overloads, arguments, best });
+    return best;
+}
+
+function_t* resolver_t::resolve(reflection_t* reflection, std::string const& name, std::vector<type_t*> const& arguments)
+{
+    if (reflection == nullptr) return nullptr;
+    return resolve(reflection->function.find(name), arguments);
+}
+
+void resolver_t::clear()
+{
+    cache.clear();
+}
+
+} // namespace eightrefl
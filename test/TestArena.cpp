@@ -0,0 +1,81 @@
+#include <EightreflTestingBase.hpp>
+
+#include <Eightrefl/Arena.hpp>
+
+#include <cstdint> // uintptr_t
+#include <memory> // unique_ptr, make_unique
+
+TEST(TestLibrary::TestArena, TestAllocate)
+{
+    eightrefl::arena_t arena(256);
+
+    EXPECT("empty", arena.capacity() == 0 && arena.used() == 0);
+
+    auto first = arena.allocate(3, 1);
+    auto second = arena.allocate(sizeof(double), alignof(double));
+
+    EXPECT("allocate", first != nullptr && second != nullptr && first != second);
+    EXPECT("allocate-align", reinterpret_cast<std::uintptr_t>(second) % alignof(double) == 0);
+    EXPECT("allocate-bump", static_cast<char*>(second) - static_cast<char*>(first) < 16);
+    EXPECT("capacity", arena.capacity() == 256);
+    EXPECT("used", arena.used() == 3 + sizeof(double));
+
+    auto large = arena.allocate(1024, 16);
+    auto next = arena.allocate(8, 8);
+
+    EXPECT("allocate-large", large != nullptr && reinterpret_cast<std::uintptr_t>(large) % 16 == 0);
+    EXPECT("allocate-large-keep", static_cast<char*>(next) - static_cast<char*>(second) < 32);
+    EXPECT("capacity-large", arena.capacity() > 1024 + 256);
+    EXPECT("used-large", arena.used() == 3 + sizeof(double) + 1024 + 8);
+}
+
+TEST(TestLibrary::TestArena, TestRegistry)
+{
+    eightrefl::registry_t registry;
+
+    auto type = registry.add<int>("int");
+
+    ASSERT("type", type != nullptr);
+
+    EXPECT("registry-capacity", registry.arena.capacity() > 0);
+    EXPECT("type-arena", type->injection.arena == &registry.arena && type->reflection->meta.arena == &registry.arena);
+
+    auto meta = type->reflection->meta.add("Meta", { "Meta", std::any(1) });
+
+    ASSERT("meta", meta != nullptr);
+    EXPECT("meta-arena", meta->meta.arena == &registry.arena);
+
+    auto overloads = type->reflection->function.add("Function", {});
+
+    ASSERT("function", overloads != nullptr);
+    EXPECT("function-arena", overloads->arena == &registry.arena);
+}
+
+TEST(TestLibrary::TestArena, TestCopy)
+{
+    eightrefl::registry_t registry;
+
+    auto type = registry.add<int>("int");
+
+    ASSERT("type", type != nullptr);
+
+    auto meta = type->reflection->meta.add("Meta", { "Meta", std::any(1) });
+
+    ASSERT("meta", meta != nullptr && meta->meta.add("Nested", { "Nested", std::any(2) }) != nullptr);
+
+    auto copy = std::make_unique<eightrefl::attribute_t<eightrefl::meta_t>>(type->reflection->meta);
+    auto copy_meta = copy->find("Meta");
+
+    ASSERT("copy", copy_meta != nullptr);
+    EXPECT("copy-deep", copy_meta != meta && copy_meta->meta.find("Nested") != meta->meta.find("Nested"));
+    EXPECT("copy-arena", copy->arena == nullptr && copy_meta->meta.arena == nullptr);
+
+    copy.reset();
+
+    EXPECT("copy-source", type->reflection->meta.find("Meta") == meta && std::any_cast<int>(meta->value) == 1);
+
+    auto nested = type->reflection->meta.add("Copied", *meta);
+
+    ASSERT("add-copy", nested != nullptr && nested != meta);
+    EXPECT("add-copy-arena", nested->meta.arena == nullptr && nested->meta.find("Nested") != nullptr);
+}
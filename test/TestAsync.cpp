@@ -0,0 +1,125 @@
+#ifdef EIGHTREFL_EXECUTOR_ENABLE
+#include <EightreflTestingBase.hpp>
+
+#include <Eightrefl/Executor.hpp>
+
+#include <Eightrefl/Standard/vector.hpp>
+
+TEST_SPACE()
+{
+
+struct TestAsyncStruct
+{
+    TestAsyncStruct() = default;
+    TestAsyncStruct(std::vector<int> data) : Data(std::move(data)) {}
+
+    int Push(int value) { Data.push_back(value); return static_cast<int>(Data.size()); }
+    int Fail(int code) { throw code; }
+
+    std::vector<int> Data;
+};
+
+} // TEST_SPACE
+
+REFLECTABLE_DECLARATION(TestAsyncStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestAsyncStruct)
+    FACTORY(R(std::vector<int>))
+    FUNCTION(Push)
+    FUNCTION(Fail)
+REFLECTABLE_INIT()
+
+TEST(TestLibrary::TestAsync, TestFunction)
+{
+    auto type = eightrefl::global()->find("TestAsyncStruct");
+
+    ASSERT("type", type != nullptr);
+
+    auto push = type->reflection->function.find("Push")->find("int(int)");
+
+    ASSERT("function", push != nullptr);
+
+    TestAsyncStruct object;
+
+    std::vector<std::future<std::any>> results;
+    for (int index = 0; index < 64; ++index)
+    {
+        results.push_back(push->call_async(&object, { index }, &object));
+    }
+
+    auto ordered = true;
+    for (int index = 0; index < 64; ++index)
+    {
+        ordered = ordered && std::any_cast<int>(results[index].get()) == index + 1;
+    }
+
+    EXPECT("function-strand", ordered && object.Data.size() == 64);
+
+    for (int index = 0; index < 64; ++index)
+    {
+        ordered = ordered && object.Data[index] == index;
+    }
+
+    EXPECT("function-strand-order", ordered);
+
+    auto fail = type->reflection->function.find("Fail")->find("int(int)");
+
+    ASSERT("function-fail", fail != nullptr);
+
+    auto failed = fail->call_async(&object, { 1 });
+
+    auto thrown = false;
+    try { failed.get(); } catch (int) { thrown = true; }
+
+    EXPECT("function-exception", thrown);
+}
+
+TEST(TestLibrary::TestAsync, TestFactory)
+{
+    auto type = eightrefl::global()->find("TestAsyncStruct");
+
+    ASSERT("type", type != nullptr);
+
+    auto factory = type->reflection->factory.find("TestAsyncStruct(std::vector<int>)");
+
+    ASSERT("factory", factory != nullptr);
+
+    auto result = factory->call_async({ std::vector<int>{ 1, 2, 3 } }).get();
+
+    EXPECT("factory-result", std::any_cast<TestAsyncStruct&>(result).Data == std::vector<int>({ 1, 2, 3 }));
+}
+
+TEST(TestLibrary::TestAsync, TestExecutor)
+{
+    auto type = eightrefl::global()->find("TestAsyncStruct");
+
+    ASSERT("type", type != nullptr);
+
+    auto push = type->reflection->function.find("Push")->find("int(int)");
+
+    ASSERT("function", push != nullptr);
+
+    TestAsyncStruct objects[4];
+    {
+        eightrefl::executor_t executor(3);
+
+        EXPECT("executor-size", executor.size() == 3);
+
+        for (int index = 0; index < 100; ++index)
+        {
+            auto& object = objects[index % 4];
+            executor.submit(push, &object, { index }, &object);
+        }
+    }
+
+    auto done = true;
+    for (auto& object : objects) done = done && object.Data.size() == 25;
+
+    EXPECT("executor-drain", done);
+
+    auto size = eightrefl::executor()->size();
+
+    EXPECT("executor-default-size", size > 0 && size <= EIGHTREFL_EXECUTOR_MAX_SIZE);
+}
+#endif // EIGHTREFL_EXECUTOR_ENABLE
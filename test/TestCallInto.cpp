@@ -0,0 +1,174 @@
+#include <EightreflTestingBase.hpp>
+
+#include <Eightrefl/Value.hpp>
+
+#include <Eightrefl/Standard/string.hpp>
+
+TEST_SPACE()
+{
+
+struct TestCallIntoStruct
+{
+    TestCallIntoStruct() = default;
+    TestCallIntoStruct(std::string const& name) : Name(name) {}
+
+    std::string Greet(std::string const& other) const { return Name + ", " + other; }
+    void Rename(std::string const& name) { Name = name; }
+
+    std::string Name = "call into storage, that is long enough to be allocated";
+};
+
+struct TestCallIntoHugeStruct
+{
+    char Data[256] = {};
+};
+
+} // TEST_SPACE
+
+REFLECTABLE_DECLARATION(TestCallIntoStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestCallIntoStruct)
+    FACTORY(R(std::string const&))
+    FUNCTION(Greet)
+    FUNCTION(Rename)
+    PROPERTY(Name)
+REFLECTABLE_INIT()
+
+REFLECTABLE_DECLARATION(TestCallIntoHugeStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestCallIntoHugeStruct)
+    FACTORY(R())
+REFLECTABLE_INIT()
+
+TEST(TestLibrary::TestCallInto, TestFunction)
+{
+    auto type = eightrefl::global()->find("TestCallIntoStruct");
+
+    ASSERT("type", type != nullptr);
+
+    auto reflection = type->reflection;
+
+    ASSERT("reflection", reflection != nullptr);
+
+    TestCallIntoStruct object;
+
+    {
+        auto greet = reflection->function.find("Greet")->find("std::string(std::string const&) const");
+
+        ASSERT("function-greet", greet != nullptr && greet->raw_call != nullptr);
+
+        std::string other = "world";
+        std::any result;
+
+        greet->call_into(&object, { &other }, result);
+
+        auto held = std::any_cast<std::string>(&result);
+
+        ASSERT("function-greet-result", held != nullptr);
+        EXPECT("function-greet-value", *held == object.Name + ", world");
+
+        auto buffer = held->data();
+
+        other = "again";
+        greet->call_into(&object, { &other }, result);
+
+        EXPECT("function-greet-reuse", std::any_cast<std::string>(&result) == held && *held == object.Name + ", again");
+        EXPECT("function-greet-buffer", held->data() == buffer);
+
+        EXPECT("function-greet-try", greet->try_call(&object, { &other }, result) == eightrefl::call_status_t::success);
+        EXPECT("function-greet-try-buffer", held->data() == buffer);
+    }
+    {
+        auto rename = reflection->function.find("Rename")->find("void(std::string const&)");
+
+        ASSERT("function-rename", rename != nullptr && rename->raw_call != nullptr);
+
+        std::string name = "renamed";
+        std::any result = 1;
+
+        rename->call_into(&object, { &name }, result);
+
+        EXPECT("function-rename-void", object.Name == "renamed" && !result.has_value());
+    }
+}
+
+TEST(TestLibrary::TestCallInto, TestFactory)
+{
+    auto type = eightrefl::global()->find("TestCallIntoStruct");
+
+    ASSERT("type", type != nullptr);
+
+    auto factory = type->reflection->factory.find("TestCallIntoStruct(std::string const&)");
+
+    ASSERT("factory", factory != nullptr && factory->raw_call != nullptr);
+
+    std::string name = "first";
+    std::any result;
+
+    factory->call_into({ &name }, result);
+
+    auto held = std::any_cast<TestCallIntoStruct>(&result);
+
+    ASSERT("factory-result", held != nullptr);
+    EXPECT("factory-value", held->Name == "first");
+
+    name = "second";
+    factory->call_into({ &name }, result);
+
+    EXPECT("factory-reuse", std::any_cast<TestCallIntoStruct>(&result) == held && held->Name == "second");
+}
+
+TEST(TestLibrary::TestCallInto, TestProperty)
+{
+    auto type = eightrefl::global()->find("TestCallIntoStruct");
+
+    ASSERT("type", type != nullptr);
+
+    auto property = type->reflection->property.find("Name");
+
+    ASSERT("property", property != nullptr);
+
+    TestCallIntoStruct object;
+    std::any result;
+
+    property->get(&object, result);
+
+    auto held = std::any_cast<std::string>(&result);
+
+    ASSERT("property-result", held != nullptr);
+    EXPECT("property-value", *held == object.Name);
+
+    auto buffer = held->data();
+
+    object.Name.back() = '!';
+    property->get(&object, result);
+
+    EXPECT("property-reuse", std::any_cast<std::string>(&result) == held && held->data() == buffer && *held == object.Name);
+}
+
+TEST(TestLibrary::TestCallInto, TestValue)
+{
+    auto type = eightrefl::global()->find("TestCallIntoHugeStruct");
+
+    ASSERT("type", type != nullptr);
+
+    auto factory = type->reflection->factory.find("TestCallIntoHugeStruct()");
+
+    ASSERT("factory", factory != nullptr && factory->raw_call != nullptr);
+
+    eightrefl::value_t value;
+
+    auto storage = value.emplace(type, [factory](void* storage) { factory->raw_call(nullptr, storage); });
+
+    EXPECT("value-heap", storage != nullptr && !value.is_inline());
+
+    auto reused = value.emplace(type, [factory](void* storage) { factory->raw_call(nullptr, storage); });
+
+    EXPECT("value-reuse", reused == storage && value.type() == type);
+
+    value.emplace<int>(1);
+
+    EXPECT("value-other-type", value.is_inline() && *value.cast<int>() == 1);
+}
@@ -0,0 +1,163 @@
+#include <EightreflTestingBase.hpp>
+
+#include <Eightrefl/CallSite.hpp>
+
+TEST_SPACE()
+{
+
+struct TestCallSiteBaseStruct
+{
+    int Get() const { return Value; }
+    int Add(int value) const { return Value + value; }
+
+    int Value = 1;
+};
+
+struct TestCallSiteOtherStruct
+{
+    int Padding = 0;
+};
+
+struct TestCallSiteDerivedStruct : TestCallSiteOtherStruct, TestCallSiteBaseStruct {};
+
+struct TestCallSiteOwnStruct
+{
+    int Get() const { return 42; }
+};
+
+struct TestCallSiteLateStruct
+{
+    int Get() const { return 7; }
+};
+
+} // TEST_SPACE
+
+REFLECTABLE_DECLARATION(TestCallSiteBaseStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestCallSiteBaseStruct)
+    FUNCTION(Get)
+    FUNCTION(Add)
+REFLECTABLE_INIT()
+
+REFLECTABLE_DECLARATION(TestCallSiteOtherStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestCallSiteOtherStruct)
+REFLECTABLE_INIT()
+
+REFLECTABLE_DECLARATION(TestCallSiteDerivedStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestCallSiteDerivedStruct)
+    PARENT(TestCallSiteOtherStruct)
+    PARENT(TestCallSiteBaseStruct)
+REFLECTABLE_INIT()
+
+REFLECTABLE_DECLARATION(TestCallSiteOwnStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestCallSiteOwnStruct)
+    FUNCTION(Get)
+REFLECTABLE_INIT()
+
+REFLECTABLE_DECLARATION(TestCallSiteLateStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestCallSiteLateStruct)
+REFLECTABLE_INIT()
+
+TEST(TestLibrary::TestCallSite, TestFind)
+{
+    auto base_type = eightrefl::global()->find("TestCallSiteBaseStruct");
+    auto derived_type = eightrefl::global()->find("TestCallSiteDerivedStruct");
+    auto other_type = eightrefl::global()->find("TestCallSiteOtherStruct");
+
+    ASSERT("type", base_type != nullptr && derived_type != nullptr && other_type != nullptr);
+
+    eightrefl::call_site_t site("Get");
+
+    auto base_target = site.find(base_type);
+
+    ASSERT("base", base_target != nullptr);
+    EXPECT("base-function", base_target->function == base_type->reflection->function.find("Get")->find("int() const"));
+    EXPECT("base-path", base_target->path.empty());
+    EXPECT("base-cache", site.find(base_type) == base_target);
+
+    auto derived_target = site.find(derived_type);
+
+    ASSERT("derived", derived_target != nullptr);
+    EXPECT("derived-function", derived_target->function == base_target->function);
+    EXPECT("derived-path", derived_target->path.size() == 1 && derived_target->path.front()->type == base_type);
+
+    EXPECT("other", site.find(other_type) == nullptr);
+    EXPECT("other-cache", site.find(other_type) == nullptr);
+
+    eightrefl::call_site_t overloaded_site("Add", "int(int) const");
+
+    EXPECT("overloaded", overloaded_site.find(derived_type) != nullptr);
+    EXPECT("overloaded-mismatch", eightrefl::call_site_t("Add", "int(int)").find(base_type) == nullptr);
+}
+
+TEST(TestLibrary::TestCallSite, TestLateFunction)
+{
+    auto type = eightrefl::global()->find("TestCallSiteLateStruct");
+
+    ASSERT("type", type != nullptr && type->reflection != nullptr);
+
+    eightrefl::call_site_t site("Get");
+
+    EXPECT("miss", site.find(type) == nullptr);
+
+    auto function = eightrefl::find_or_add_function(type->reflection, "Get", &TestCallSiteLateStruct::Get);
+
+    auto target = site.find(type);
+
+    ASSERT("late", target != nullptr);
+    EXPECT("late-function", target->function == function);
+}
+
+TEST(TestLibrary::TestCallSite, TestCall)
+{
+    auto derived_type = eightrefl::global()->find("TestCallSiteDerivedStruct");
+    auto own_type = eightrefl::global()->find("TestCallSiteOwnStruct");
+
+    ASSERT("type", derived_type != nullptr && own_type != nullptr);
+
+    TestCallSiteDerivedStruct derived;
+    derived.Value = 7;
+
+    TestCallSiteOwnStruct own;
+
+    eightrefl::call_site_t site("Get");
+
+    {
+        int result = 0;
+
+        EXPECT("raw_call-derived", site.raw_call(derived_type, &derived, nullptr, &result) && result == 7);
+        EXPECT("raw_call-own", site.raw_call(own_type, &own, nullptr, &result) && result == 42);
+    }
+    {
+        std::any result;
+
+        EXPECT("call-derived", site.call(derived_type, &derived, {}, result) == eightrefl::call_status_t::success);
+        EXPECT("call-derived-result", std::any_cast<int>(result) == 7);
+        EXPECT("call-own-mismatch", site.call(own_type, &derived, {}, result) == eightrefl::call_status_t::context_mismatch);
+    }
+
+    eightrefl::call_site_t add_site("Add");
+
+    {
+        int value = 3;
+        int result = 0;
+
+        void* arguments[] = { &value };
+
+        EXPECT("raw_call-arguments", add_site.raw_call(derived_type, &derived, arguments, &result) && result == 10);
+        EXPECT("raw_call-unknown", !add_site.raw_call(own_type, &own, arguments, &result));
+
+        std::any any_result;
+
+        EXPECT("call-unknown", add_site.call(own_type, &own, { 3 }, any_result) == eightrefl::call_status_t::not_callable);
+    }
+}
@@ -0,0 +1,125 @@
+#include <EightreflTestingBase.hpp>
+
+#include <thread> // thread
+#include <atomic> // atomic
+#include <vector> // vector
+
+TEST_SPACE()
+{
+
+template <int IndexValue>
+struct TestConcurrentStruct
+{
+    int Get() const { return IndexValue; }
+
+    int Value = IndexValue;
+};
+
+} // TEST_SPACE
+
+TEMPLATE_REFLECTABLE_DECLARATION((template <int IndexValue>), TestConcurrentStruct<IndexValue>)
+    REFLECTABLE_NAME("TestConcurrentStruct<" + std::to_string(IndexValue) + ">")
+REFLECTABLE_DECLARATION_INIT()
+
+TEMPLATE_REFLECTABLE((template <int IndexValue>), TestConcurrentStruct<IndexValue>)
+    FUNCTION(Get)
+    PROPERTY(Value)
+REFLECTABLE_INIT()
+
+TEST(TestLibrary::TestConcurrent, TestRegistry)
+{
+    eightrefl::registry_t registry;
+
+    std::atomic<bool> stop = false;
+    std::atomic<int> misses = 0;
+
+    std::thread reader([&]
+    {
+        while (!stop)
+        {
+            auto type = registry.find("type0");
+            if (type != nullptr && type->name != "type0") ++misses;
+        }
+    });
+
+    std::vector<std::thread> writers;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        writers.emplace_back([&registry]
+        {
+            for (int index = 0; index < 256; ++index)
+            {
+                registry.add<int>("type" + std::to_string(index));
+            }
+        });
+    }
+
+    for (auto& writer : writers) writer.join();
+
+    stop = true;
+    reader.join();
+
+    auto found = true;
+    for (int index = 0; index < 256; ++index)
+    {
+        auto type = registry.find("type" + std::to_string(index));
+        found = found && type != nullptr && type->name == "type" + std::to_string(index);
+    }
+
+    EXPECT("registry-add", registry.all.size() == 256 && found && misses == 0);
+}
+
+TEST(TestLibrary::TestConcurrent, TestAttribute)
+{
+    eightrefl::registry_t registry;
+
+    auto type = registry.add<int>("int");
+
+    ASSERT("type", type != nullptr);
+
+    auto& meta = type->reflection->meta;
+
+    std::vector<std::thread> writers;
+    std::vector<eightrefl::meta_t*> first(4, nullptr);
+
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        writers.emplace_back([&meta, &first, thread]
+        {
+            for (int index = 0; index < 256; ++index)
+            {
+                auto name = "Meta" + std::to_string(index);
+                auto item = meta.add(name, { name, std::any(index) });
+                if (index == 0) first[thread] = item;
+            }
+        });
+    }
+
+    for (auto& writer : writers) writer.join();
+
+    EXPECT("attribute-add", meta.all.size() == 256 && meta.find("Meta255") != nullptr);
+    EXPECT("attribute-add-existing", first[0] == first[1] && first[1] == first[2] && first[2] == first[3]);
+}
+
+TEST(TestLibrary::TestConcurrent, TestReflectable)
+{
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([]
+        {
+            eightrefl::reflectable<TestConcurrentStruct<1>>();
+            eightrefl::reflectable<TestConcurrentStruct<2>>();
+        });
+    }
+
+    for (auto& thread : threads) thread.join();
+
+    auto type = eightrefl::global()->find("TestConcurrentStruct<1>");
+
+    ASSERT("type", type != nullptr);
+
+    EXPECT("function", type->reflection->function.find("Get") != nullptr);
+    EXPECT("property", type->reflection->property.find("Value") != nullptr);
+    EXPECT("type-other", eightrefl::global()->find("TestConcurrentStruct<2>") != nullptr);
+}
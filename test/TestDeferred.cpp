@@ -0,0 +1,103 @@
+// EIGHTREFL_DEFER_REFLECTION_FIXTURE is defined for whole EightreflDeferredTests target
+#include <EightreflTestingBase.hpp>
+
+#include <vector> // vector
+#include <thread> // thread, sleep_for
+#include <atomic> // atomic
+#include <chrono> // milliseconds
+
+TEST_SPACE()
+{
+
+struct TestDeferredStruct
+{
+    int Get() const { return Value; }
+
+    int Value = 0;
+};
+
+struct TestDeferredOtherStruct
+{
+    int Value = 0;
+};
+
+} // TEST_SPACE
+
+REFLECTABLE_DECLARATION(TestDeferredStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestDeferredStruct)
+    FUNCTION(Get)
+    PROPERTY(Value)
+REFLECTABLE_INIT()
+
+REFLECTABLE_DECLARATION(TestDeferredOtherStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestDeferredOtherStruct)
+    PROPERTY(Value)
+REFLECTABLE_INIT()
+
+TEST(TestLibrary::TestDeferred, TestFind)
+{
+    auto registry = eightrefl::global();
+
+    EXPECT("deferred", registry->deferred.count("TestDeferredStruct") == 1 || registry->all.count("TestDeferredStruct") == 1);
+
+    auto type = registry->find("TestDeferredStruct");
+
+    ASSERT("type", type != nullptr && type->name == "TestDeferredStruct");
+
+    EXPECT("deferred-evaluated", registry->deferred.count("TestDeferredStruct") == 0);
+    EXPECT("function", type->reflection->function.find("Get") != nullptr);
+    EXPECT("property", type->reflection->property.find("Value") != nullptr);
+
+    EXPECT("find-again", registry->find("TestDeferredStruct") == type);
+    EXPECT("type_of", eightrefl::find_or_add_type<TestDeferredStruct>() == type);
+}
+
+TEST(TestLibrary::TestDeferred, TestEvaluate)
+{
+    eightrefl::registry_t registry;
+
+    static auto count = 0;
+    registry.defer("int", [] { ++count; });
+
+    EXPECT("defer", registry.deferred.size() == 1 && registry.all.empty());
+
+    registry.evaluate_deferred();
+
+    EXPECT("evaluate", count == 1 && registry.deferred.empty());
+    EXPECT("evaluate-once", registry.find("int") == nullptr && count == 1);
+
+    eightrefl::global()->evaluate_deferred();
+
+    EXPECT("evaluate-global", eightrefl::global()->all.count("TestDeferredOtherStruct") == 1);
+}
+
+TEST(TestLibrary::TestDeferred, TestConcurrentFind)
+{
+    static eightrefl::registry_t registry;
+
+    // type is added only after a while, so other lookups run while evaluation is in flight
+    registry.defer("Slow", []
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        registry.add<int>("Slow");
+    });
+
+    std::atomic<int> found = 0;
+
+    std::vector<std::thread> threads;
+    for (int index = 0; index < 8; ++index)
+    {
+        threads.emplace_back([&found]
+        {
+            if (registry.find("Slow") != nullptr) ++found;
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    EXPECT("find", found == 8);
+    EXPECT("evaluated", registry.deferred.empty());
+}
@@ -0,0 +1,105 @@
+#include <EightreflTestingBase.hpp>
+
+#include <Eightrefl/Delegate.hpp>
+
+TEST_SPACE()
+{
+
+struct TestDelegateBaseStruct
+{
+    int Add(int value) { return Value += value; }
+    static int Twice(int value) { return 2 * value; }
+
+    int Value = 1;
+};
+
+struct TestDelegateOtherStruct
+{
+    int Padding = 0;
+};
+
+struct TestDelegateDerivedStruct : TestDelegateOtherStruct, TestDelegateBaseStruct {};
+
+} // TEST_SPACE
+
+REFLECTABLE_DECLARATION(TestDelegateBaseStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestDelegateBaseStruct)
+    FUNCTION(Add)
+    FUNCTION(Twice)
+REFLECTABLE_INIT()
+
+REFLECTABLE_DECLARATION(TestDelegateOtherStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestDelegateOtherStruct)
+REFLECTABLE_INIT()
+
+REFLECTABLE_DECLARATION(TestDelegateDerivedStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestDelegateDerivedStruct)
+    PARENT(TestDelegateOtherStruct)
+    PARENT(TestDelegateBaseStruct)
+REFLECTABLE_INIT()
+
+TEST(TestLibrary::TestDelegate, TestBind)
+{
+    auto base_type = eightrefl::global()->find("TestDelegateBaseStruct");
+    auto derived_type = eightrefl::global()->find("TestDelegateDerivedStruct");
+    auto other_type = eightrefl::global()->find("TestDelegateOtherStruct");
+
+    ASSERT("type", base_type != nullptr && derived_type != nullptr && other_type != nullptr);
+
+    TestDelegateDerivedStruct derived;
+
+    auto delegate = eightrefl::bind(derived_type, &derived, "Add");
+
+    ASSERT("delegate", delegate);
+    EXPECT("delegate-function", delegate.function == base_type->reflection->function.find("Add")->find("int(int)"));
+    EXPECT("delegate-context", delegate.context == static_cast<TestDelegateBaseStruct*>(&derived));
+
+    EXPECT("delegate-signature", eightrefl::bind(derived_type, &derived, "Add", "int(int)"));
+    EXPECT("delegate-signature-mismatch", !eightrefl::bind(derived_type, &derived, "Add", "int(int) const"));
+    EXPECT("delegate-unknown", !eightrefl::bind(other_type, &derived, "Add"));
+
+    std::any object = TestDelegateDerivedStruct{};
+
+    auto any_delegate = eightrefl::bind(derived_type, object, "Add");
+
+    ASSERT("delegate-any", any_delegate);
+    EXPECT("delegate-any-context",
+           any_delegate.context == static_cast<TestDelegateBaseStruct*>(std::any_cast<TestDelegateDerivedStruct>(&object)));
+}
+
+TEST(TestLibrary::TestDelegate, TestCall)
+{
+    auto derived_type = eightrefl::global()->find("TestDelegateDerivedStruct");
+
+    ASSERT("type", derived_type != nullptr);
+
+    TestDelegateDerivedStruct derived;
+
+    auto add = eightrefl::bind(derived_type, &derived, "Add");
+
+    ASSERT("add", add);
+
+    int value = 2;
+    int result = 0;
+
+    void* arguments[] = { &value };
+
+    add(arguments, &result);
+    add(arguments, &result);
+
+    EXPECT("add-result", result == 5 && derived.Value == 5);
+
+    auto twice = eightrefl::bind(derived_type, &derived, "Twice");
+
+    ASSERT("twice", twice);
+
+    twice(arguments, &result);
+
+    EXPECT("twice-result", result == 4);
+}
@@ -88,6 +88,12 @@ TEST(TestLibrary, TestDeleter)
         custom->call(object);
 
         EXPECT("custom-deleter-call", TestMetaValue(object, 'd'));
+
+        object = new (memory.get()) TestDeleterStruct();
+        SetMetaValue(object, 'c');
+        custom->destroy_at(object);
+
+        EXPECT("custom-deleter-destroy_at", TestMetaValue(object, 'd'));
     }
     {
         auto custom = reflection->deleter.find("TestCustomDeleterStructTemplate<TestDeleterStruct>(TestDeleterStruct*)");
@@ -22,6 +22,9 @@ TEST(TestDev, TestAttribute)
 
     EXPECT("function-find", reflection->function.find("find") != nullptr);
     EXPECT("function-add", reflection->function.find("add") != nullptr);
+    EXPECT("function-freeze", reflection->function.find("freeze") != nullptr);
+    EXPECT("function-thaw", reflection->function.find("thaw") != nullptr);
+    EXPECT("function-frozen", reflection->function.find("frozen") != nullptr);
     EXPECT("property-all", reflection->property.find("all") != nullptr);
 }
 
@@ -42,6 +45,7 @@ TEST(TestDev, TestParent)
     EXPECT("property-name", reflection->property.find("name") != nullptr);
     EXPECT("property-type", reflection->property.find("type") != nullptr);
     EXPECT("property-cast", reflection->property.find("cast") != nullptr);
+    EXPECT("property-raw_cast", reflection->property.find("raw_cast") != nullptr);
     EXPECT("property-meta", reflection->property.find("meta") != nullptr);
 }
 
@@ -61,6 +65,11 @@ TEST(TestDev, TestFactory)
 
     EXPECT("property-name", reflection->property.find("name") != nullptr);
     EXPECT("property-call", reflection->property.find("call") != nullptr);
+    EXPECT("function-move_call", reflection->function.find("move_call") != nullptr);
+    EXPECT("function-call_into", reflection->function.find("call_into") != nullptr);
+    EXPECT("function-try_call", reflection->function.find("try_call") != nullptr);
+    EXPECT("property-raw_call", reflection->property.find("raw_call") != nullptr);
+    EXPECT("property-raw_move_call", reflection->property.find("raw_move_call") != nullptr);
     EXPECT("property-arguments", reflection->property.find("arguments") != nullptr);
     EXPECT("property-meta", reflection->property.find("meta") != nullptr);
 }
@@ -81,7 +90,15 @@ TEST(TestDev, TestFunction)
 
     EXPECT("property-name", reflection->property.find("name") != nullptr);
     EXPECT("property-call", reflection->property.find("call") != nullptr);
+    EXPECT("function-move_call", reflection->function.find("move_call") != nullptr);
+    EXPECT("function-call_into", reflection->function.find("call_into") != nullptr);
+    EXPECT("function-try_call", reflection->function.find("try_call") != nullptr);
+    EXPECT("property-raw_call", reflection->property.find("raw_call") != nullptr);
+    EXPECT("property-raw_move_call", reflection->property.find("raw_move_call") != nullptr);
+    EXPECT("property-raw_batch_call", reflection->property.find("raw_batch_call") != nullptr);
+    EXPECT("property-raw_object", reflection->property.find("raw_object") != nullptr);
     EXPECT("property-arguments", reflection->property.find("arguments") != nullptr);
+    EXPECT("property-pointer_arguments", reflection->property.find("pointer_arguments") != nullptr);
     EXPECT("property-result", reflection->property.find("result") != nullptr);
     EXPECT("property-pointer", reflection->property.find("pointer") != nullptr);
     EXPECT("property-meta", reflection->property.find("meta") != nullptr);
@@ -105,7 +122,20 @@ TEST(TestDev, TestProperty)
     EXPECT("property-type", reflection->property.find("type") != nullptr);
     EXPECT("property-get", reflection->property.find("get") != nullptr);
     EXPECT("property-set", reflection->property.find("set") != nullptr);
+    EXPECT("function-move_set", reflection->function.find("move_set") != nullptr);
+    EXPECT("function-try_set", reflection->function.find("try_set") != nullptr);
     EXPECT("property-context", reflection->property.find("context") != nullptr);
+    EXPECT("property-raw_get", reflection->property.find("raw_get") != nullptr);
+    EXPECT("property-raw_set", reflection->property.find("raw_set") != nullptr);
+    EXPECT("property-raw_move_set", reflection->property.find("raw_move_set") != nullptr);
+    EXPECT("property-raw_context", reflection->property.find("raw_context") != nullptr);
+    EXPECT("property-raw_batch_get", reflection->property.find("raw_batch_get") != nullptr);
+    EXPECT("property-raw_batch_set", reflection->property.find("raw_batch_set") != nullptr);
+    EXPECT("property-raw_object", reflection->property.find("raw_object") != nullptr);
+    EXPECT("property-offset", reflection->property.find("offset") != nullptr);
+    EXPECT("property-size", reflection->property.find("size") != nullptr);
+    EXPECT("property-alignment", reflection->property.find("alignment") != nullptr);
+    EXPECT("property-plain", reflection->property.find("plain") != nullptr);
     EXPECT("property-meta", reflection->property.find("meta") != nullptr);
 }
 
@@ -125,6 +155,7 @@ TEST(TestDev, TestDeleter)
 
     EXPECT("property-name", reflection->property.find("name") != nullptr);
     EXPECT("property-type", reflection->property.find("call") != nullptr);
+    EXPECT("property-raw_call", reflection->property.find("raw_call") != nullptr);
     EXPECT("property-meta", reflection->property.find("meta") != nullptr);
 }
 
@@ -187,6 +218,41 @@ TEST(TestDev, TestInjection)
     EXPECT("property-call", reflection->property.find("call") != nullptr);
 }
 
+TEST(TestDev, TestAtom)
+{
+    auto type = eightrefl::dev()->find("eightrefl::atom_t");
+
+    ASSERT("type", type != nullptr);
+    EXPECT("type-name", type->name == "eightrefl::atom_t");
+    EXPECT("type-size", type->size == sizeof(eightrefl::atom_t));
+    EXPECT("type-context", type->context != nullptr);
+
+    auto reflection = type->reflection;
+
+    ASSERT("reflection", reflection != nullptr);
+    EXPECT("reflection-name", reflection->name == "eightrefl::atom_t");
+
+    EXPECT("property-id", reflection->property.find("id") != nullptr);
+}
+
+TEST(TestDev, TestHashedName)
+{
+    auto type = eightrefl::dev()->find("eightrefl::hashed_name_t");
+
+    ASSERT("type", type != nullptr);
+    EXPECT("type-name", type->name == "eightrefl::hashed_name_t");
+    EXPECT("type-size", type->size == sizeof(eightrefl::hashed_name_t));
+    EXPECT("type-context", type->context != nullptr);
+
+    auto reflection = type->reflection;
+
+    ASSERT("reflection", reflection != nullptr);
+    EXPECT("reflection-name", reflection->name == "eightrefl::hashed_name_t");
+
+    EXPECT("factory-R(std::string const&)", reflection->factory.find("eightrefl::hashed_name_t(std::string const&)") != nullptr);
+    EXPECT("property-hash", reflection->property.find("hash") != nullptr);
+}
+
 TEST(TestDev, TestType)
 {
     auto type = eightrefl::dev()->find("eightrefl::type_t");
@@ -202,10 +268,19 @@ TEST(TestDev, TestType)
     EXPECT("reflection-name", reflection->name == "eightrefl::type_t");
 
     EXPECT("property-name", reflection->property.find("name") != nullptr);
+    EXPECT("property-atom", reflection->property.find("atom") != nullptr);
     EXPECT("property-reflection", reflection->property.find("reflection") != nullptr);
     EXPECT("property-registry", reflection->property.find("registry") != nullptr);
+    EXPECT("property-id", reflection->property.find("id") != nullptr);
     EXPECT("property-size", reflection->property.find("size") != nullptr);
+    EXPECT("property-alignment", reflection->property.find("alignment") != nullptr);
     EXPECT("property-context", reflection->property.find("context") != nullptr);
+    EXPECT("property-raw_context", reflection->property.find("raw_context") != nullptr);
+    EXPECT("property-copy", reflection->property.find("copy") != nullptr);
+    EXPECT("property-move", reflection->property.find("move") != nullptr);
+    EXPECT("property-destroy", reflection->property.find("destroy") != nullptr);
+    EXPECT("property-assign", reflection->property.find("assign") != nullptr);
+    EXPECT("property-pointee", reflection->property.find("pointee") != nullptr);
     EXPECT("property-injection", reflection->property.find("injection") != nullptr);
 }
 
@@ -217,6 +292,7 @@ TEST(TestDev, TestRegistry)
     EXPECT("type-name", type->name == "eightrefl::registry_t");
     EXPECT("type-size", type->size == sizeof(eightrefl::registry_t));
     EXPECT("type-context", type->context != nullptr);
+    EXPECT("type-copy", type->copy == nullptr);
 
     auto reflection = type->reflection;
 
@@ -225,6 +301,10 @@ TEST(TestDev, TestRegistry)
 
     EXPECT("factory-R()", reflection->factory.find("eightrefl::registry_t()") != nullptr);
     EXPECT("function-find", reflection->function.find("find") != nullptr);
+    EXPECT("function-evaluate_deferred", reflection->function.find("evaluate_deferred") != nullptr);
+    EXPECT("function-freeze", reflection->function.find("freeze") != nullptr);
+    EXPECT("function-thaw", reflection->function.find("thaw") != nullptr);
+    EXPECT("function-frozen", reflection->function.find("frozen") != nullptr);
     EXPECT("property-all", reflection->property.find("all") != nullptr);
     EXPECT("property-rtti_all", reflection->property.find("rtti_all") != nullptr);
 }
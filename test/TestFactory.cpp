@@ -81,3 +81,84 @@ TEST(TestLibrary, TestFactoryStruct)
         EXPECT("custom-factory-template-object", object_ptr != nullptr && object_ptr->result);
     }
 }
+
+TEST_SPACE()
+{
+
+struct TestInPlaceFactoryStruct
+{
+    static int Alive;
+    static int Limit;
+
+    TestInPlaceFactoryStruct(int value) : Value(value)
+    {
+        if (Alive == Limit) throw Alive;
+        ++Alive;
+    }
+
+    ~TestInPlaceFactoryStruct() { --Alive; }
+
+    int Value = 0;
+};
+
+int TestInPlaceFactoryStruct::Alive = 0;
+int TestInPlaceFactoryStruct::Limit = -1;
+
+} // TEST_SPACE
+
+REFLECTABLE_DECLARATION(TestInPlaceFactoryStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestInPlaceFactoryStruct)
+    FACTORY(R(int))
+    DELETER(void(R*))
+REFLECTABLE_INIT()
+
+TEST(TestLibrary, TestInPlaceFactoryStruct)
+{
+    auto type = eightrefl::global()->find("TestInPlaceFactoryStruct");
+
+    ASSERT("type", type != nullptr);
+    EXPECT("type-alignment", type->alignment == alignof(TestInPlaceFactoryStruct));
+
+    auto factory = type->reflection->factory.find("TestInPlaceFactoryStruct(int)");
+    auto deleter = type->reflection->deleter.find("void(TestInPlaceFactoryStruct*)");
+
+    ASSERT("factory", factory != nullptr);
+    ASSERT("deleter", deleter != nullptr && deleter->raw_call != nullptr);
+
+    alignas(TestInPlaceFactoryStruct) unsigned char storage[4 * sizeof(TestInPlaceFactoryStruct)];
+
+    int value = 7;
+    void* arguments[] = { &value };
+
+    {
+        factory->construct_at(storage, arguments);
+
+        EXPECT("construct_at", TestInPlaceFactoryStruct::Alive == 1 && reinterpret_cast<TestInPlaceFactoryStruct*>(storage)->Value == 7);
+
+        deleter->destroy_at(storage);
+
+        EXPECT("destroy_at", TestInPlaceFactoryStruct::Alive == 0);
+    }
+    {
+        factory->construct_array_at(storage, 4, arguments);
+
+        EXPECT("construct_array_at", TestInPlaceFactoryStruct::Alive == 4 && reinterpret_cast<TestInPlaceFactoryStruct*>(storage)[3].Value == 7);
+
+        deleter->destroy_array_at(storage, 4);
+
+        EXPECT("destroy_array_at", TestInPlaceFactoryStruct::Alive == 0);
+    }
+    {
+        TestInPlaceFactoryStruct::Limit = 2;
+
+        auto thrown = false;
+        try { factory->construct_array_at(storage, 4, arguments); }
+        catch (int) { thrown = true; }
+
+        TestInPlaceFactoryStruct::Limit = -1;
+
+        EXPECT("construct_array_at-rollback", thrown && TestInPlaceFactoryStruct::Alive == 0);
+    }
+}
@@ -0,0 +1,97 @@
+#include <EightreflTestingBase.hpp>
+
+#include <Eightrefl/Standard/string.hpp>
+
+#include <algorithm> // find
+
+TEST_SPACE()
+{
+
+struct TestFindAnyStruct {};
+
+} // TEST_SPACE
+
+REFLECTABLE_DECLARATION(TestFindAnyStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestFindAnyStruct)
+REFLECTABLE_INIT()
+
+TEST(TestLibrary::TestFindAny, TestFind)
+{
+    auto type = eightrefl::find_any("TestFindAnyStruct");
+
+    ASSERT("type", type != nullptr && type == eightrefl::global()->find("TestFindAnyStruct"));
+
+    EXPECT("builtin", eightrefl::find_any("int") == eightrefl::builtin()->find("int"));
+    EXPECT("standard", eightrefl::find_any("std::string") == eightrefl::standard()->find("std::string"));
+    EXPECT("unknown", eightrefl::find_any("TestFindAnyUnknown") == nullptr);
+
+    EXPECT("owner", eightrefl::find_any("TestFindAnyStruct", eightrefl::global()) == type);
+    EXPECT("owner-other", eightrefl::find_any("TestFindAnyStruct", eightrefl::builtin()) == nullptr);
+}
+
+TEST(TestLibrary::TestFindAny, TestRegistry)
+{
+    auto builtin_type = eightrefl::builtin()->find("int");
+
+    ASSERT("type", builtin_type != nullptr);
+    {
+        eightrefl::registry_t registry;
+
+        auto type = registry.add<int>("int");
+
+        ASSERT("local", type != nullptr);
+
+        EXPECT("first", eightrefl::find_any("int") == builtin_type);
+        EXPECT("owner", eightrefl::find_any("int", &registry) == type);
+
+        auto types = eightrefl::find_all("int");
+
+        EXPECT("find_all", types.size() >= 2 && types.front() == builtin_type
+            && std::find(types.begin(), types.end(), type) != types.end());
+    }
+
+    auto types = eightrefl::find_all("int");
+
+    EXPECT("unpublish", types.size() >= 1 && types.front() == builtin_type);
+}
+
+TEST(TestLibrary::TestFindAny, TestDeferred)
+{
+    static eightrefl::registry_t* xxregistry = nullptr;
+
+    eightrefl::registry_t registry;
+    xxregistry = &registry;
+
+    registry.defer("TestFindAnyDeferred", [] { xxregistry->add<int>("TestFindAnyDeferred"); });
+
+    ASSERT("deferred", registry.all.empty());
+
+    auto type = eightrefl::find_any("TestFindAnyDeferred");
+
+    ASSERT("find_any", type != nullptr && type->registry == &registry);
+    EXPECT("evaluated", registry.deferred.empty());
+
+    registry.defer("TestFindAnyDeferredOwner", [] { xxregistry->add<int>("TestFindAnyDeferredOwner"); });
+
+    EXPECT("owner-other", eightrefl::find_any("TestFindAnyDeferredOwner", eightrefl::global()) == nullptr);
+    EXPECT("owner-other-pending", registry.deferred.size() == 1);
+    EXPECT("owner", eightrefl::find_any("TestFindAnyDeferredOwner", &registry) != nullptr);
+
+    registry.defer("TestFindAnyDeferredAll", [] { xxregistry->add<int>("TestFindAnyDeferredAll"); });
+
+    auto types = eightrefl::find_all("TestFindAnyDeferredAll");
+
+    EXPECT("find_all", types.size() == 1 && types.front()->registry == &registry);
+}
+
+TEST(TestLibrary::TestFindAny, TestDeferredDestroyed)
+{
+    {
+        eightrefl::registry_t registry;
+        registry.defer("TestFindAnyDeferredDestroyed", [] {});
+    }
+
+    EXPECT("destroyed", eightrefl::find_any("TestFindAnyDeferredDestroyed") == nullptr);
+}
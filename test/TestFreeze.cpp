@@ -0,0 +1,114 @@
+#include <EightreflTestingBase.hpp>
+
+#include <string_view> // string_view
+#include <stdexcept> // logic_error
+
+TEST(TestLibrary::TestFreeze, TestRegistry)
+{
+    eightrefl::registry_t registry;
+
+    auto int_type = registry.add<int>("int");
+    auto float_type = registry.add<float>("float");
+
+    ASSERT("type", int_type != nullptr && float_type != nullptr);
+
+    for (int index = 0; index < 100; ++index)
+    {
+        registry.add<char>("char" + std::to_string(index));
+    }
+
+    registry.freeze();
+
+    EXPECT("frozen", registry.frozen() && int_type->reflection->meta.frozen());
+
+    EXPECT("find", registry.find("int") == int_type && registry.find("float") == float_type);
+    EXPECT("find-string_view", registry.find(std::string_view("float")) == float_type);
+    EXPECT("find-unknown", registry.find("double") == nullptr && registry.find("") == nullptr);
+
+    auto found = true;
+    for (int index = 0; index < 100; ++index)
+    {
+        auto type = registry.find("char" + std::to_string(index));
+        found = found && type != nullptr && type->name == "char" + std::to_string(index);
+    }
+
+    EXPECT("find-all", found);
+
+    EXPECT("add-existing", registry.add<int>("int") == int_type);
+
+    auto thrown = false;
+    try { registry.add<double>("double"); }
+    catch (std::logic_error const&) { thrown = true; }
+
+    EXPECT("add-frozen", thrown && registry.find("double") == nullptr && registry.all.count("double") == 0);
+
+    thrown = false;
+    try { int_type->reflection->meta.add("Meta", { "Meta", std::any(1) }); }
+    catch (std::logic_error const&) { thrown = true; }
+
+    EXPECT("add-frozen-meta", thrown && int_type->reflection->meta.find("Meta") == nullptr);
+
+    thrown = false;
+    try { registry.defer("double", nullptr); }
+    catch (std::logic_error const&) { thrown = true; }
+
+    EXPECT("defer-frozen", thrown && registry.deferred.empty());
+
+    registry.thaw();
+
+    EXPECT("thaw", !registry.frozen() && !int_type->reflection->meta.frozen());
+
+    auto double_type = registry.add<double>("double");
+
+    ASSERT("thaw-add", double_type != nullptr && registry.find("double") == double_type);
+    EXPECT("thaw-add-meta", double_type->reflection->meta.add("Meta", { "Meta", std::any(1) }) != nullptr);
+
+    registry.freeze();
+
+    EXPECT("refreeze", registry.frozen_index.find("double") == double_type && double_type->reflection->meta.frozen());
+    EXPECT("refreeze-meta", double_type->reflection->meta.frozen_index.find("Meta") != nullptr);
+
+    registry.thaw();
+
+    EXPECT("thaw-find", registry.find("double") == double_type && registry.find("int") == int_type);
+}
+
+TEST(TestLibrary::TestFreeze, TestAttribute)
+{
+    eightrefl::registry_t registry;
+
+    auto type = registry.add<int>("int");
+
+    ASSERT("type", type != nullptr);
+
+    auto reflection = type->reflection;
+
+    auto meta = reflection->meta.add("Meta", { "Meta", std::any(1) });
+    auto submeta = meta->meta.add("Submeta", { "Submeta", std::any(2) });
+
+    auto overloads = reflection->function.add("Function", {});
+    auto function = overloads->add("int()", { "int()" });
+
+    registry.freeze();
+
+    EXPECT("meta", reflection->meta.find("Meta") == meta && meta->meta.find("Submeta") == submeta);
+    EXPECT("meta-frozen", reflection->meta.frozen() && meta->meta.frozen());
+    EXPECT("meta-unknown", reflection->meta.find("Other") == nullptr);
+
+    auto thrown = false;
+    try { reflection->meta.add("Other", { "Other", std::any(3) }); }
+    catch (std::logic_error const&) { thrown = true; }
+
+    EXPECT("meta-add-frozen", thrown && reflection->meta.frozen() && reflection->meta.find("Other") == nullptr);
+    EXPECT("meta-add-existing", reflection->meta.add("Meta", { "Meta", std::any(4) }) == meta);
+
+    EXPECT("function", reflection->function.find("Function") == overloads && overloads->find("int()") == function);
+    EXPECT("function-frozen", overloads->frozen() && function->meta.frozen());
+
+    registry.thaw();
+
+    auto other = reflection->meta.add("Other", { "Other", std::any(5) });
+
+    EXPECT("meta-thaw-add", other != nullptr);
+    EXPECT("meta-thaw-find", reflection->meta.find("Other") == other && reflection->meta.find("Meta") == meta);
+}
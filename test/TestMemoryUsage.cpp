@@ -0,0 +1,95 @@
+#include <EightreflTestingBase.hpp>
+
+TEST_SPACE()
+{
+
+struct TestMemoryUsageStruct
+{
+    int Get() const { return Value; }
+
+    int Value = 0;
+};
+
+} // TEST_SPACE
+
+REFLECTABLE_DECLARATION(TestMemoryUsageStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestMemoryUsageStruct)
+    FUNCTION(Get)
+    PROPERTY(Value)
+    META("Meta", 1)
+REFLECTABLE_INIT()
+
+TEST(TestLibrary::TestMemoryUsage, TestRegistry)
+{
+    eightrefl::registry_t registry;
+
+    auto empty = registry.memory_usage();
+
+    EXPECT("empty", empty.type == 0 && empty.reflection == 0 && empty.index > 0);
+
+    auto type = registry.add<int>("int");
+
+    ASSERT("type", type != nullptr);
+
+    auto usage = registry.memory_usage();
+
+    EXPECT("type", usage.type > 0 && usage.reflection > 0 && usage.handler > 0);
+
+    type->reflection->meta.add("Meta", { "Meta", std::any(1) });
+
+    auto meta_usage = registry.memory_usage();
+
+    EXPECT("meta", meta_usage.meta > usage.meta && meta_usage.type == usage.type);
+
+    EXPECT("total", meta_usage.total() == meta_usage.type + meta_usage.reflection + meta_usage.parent
+        + meta_usage.factory + meta_usage.function + meta_usage.property + meta_usage.deleter + meta_usage.meta
+        + meta_usage.injection + meta_usage.name + meta_usage.handler + meta_usage.index + meta_usage.rtti_all
+        + meta_usage.arena_slack + meta_usage.atom_pool);
+
+    EXPECT("arena_slack", meta_usage.arena_slack == registry.arena.capacity() - registry.arena.used());
+    EXPECT("atom_pool", meta_usage.atom_pool > 0);
+}
+
+TEST(TestLibrary::TestMemoryUsage, TestAtomPool)
+{
+    std::string const name = "TestMemoryUsageAtomPool, that is long enough to be allocated";
+    std::size_t const count = 1024;
+
+    std::vector<std::string> type_names;
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        type_names.push_back("TestMemoryUsageAtomPool" + std::to_string(index));
+        eightrefl::intern(type_names.back());
+    }
+
+    eightrefl::registry_t registry;
+
+    auto before = registry.memory_usage().atom_pool;
+
+    for (auto const& type_name : type_names)
+    {
+        registry.add<int>(type_name)->reflection->meta.add(name, { name, std::any(1) });
+    }
+
+    auto after = registry.memory_usage().atom_pool;
+
+    // keys of all meta attributes view one interned text, while std::string keys would keep a copy each
+    EXPECT("atom_pool-shared", after > before && after - before < count * (name.size() + 1));
+}
+
+TEST(TestLibrary::TestMemoryUsage, TestGlobal)
+{
+    auto usage = eightrefl::global()->memory_usage();
+
+    EXPECT("function", usage.function > 0);
+    EXPECT("property", usage.property > 0);
+    EXPECT("meta", usage.meta > 0);
+    EXPECT("factory", usage.factory > 0);
+    EXPECT("name", usage.name > 0);
+
+    #ifdef EIGHTREFL_RTTI_ALL_ENABLE
+    EXPECT("rtti_all", usage.rtti_all > 0);
+    #endif // EIGHTREFL_RTTI_ALL_ENABLE
+}
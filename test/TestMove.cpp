@@ -0,0 +1,101 @@
+#include <EightreflTestingBase.hpp>
+
+#include <Eightrefl/Standard/vector.hpp>
+
+TEST_SPACE()
+{
+
+struct TestMoveStruct
+{
+    TestMoveStruct() = default;
+    TestMoveStruct(std::vector<int> data) : Data(std::move(data)) {}
+
+    int Take(std::vector<int> data, int& count) { Data = std::move(data); return ++count; }
+
+    std::vector<int> GetData() const { return Data; }
+    void SetData(std::vector<int> data) { Data = std::move(data); }
+
+    std::vector<int> Data;
+};
+
+} // TEST_SPACE
+
+REFLECTABLE_DECLARATION(TestMoveStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestMoveStruct)
+    FACTORY(R(std::vector<int>))
+    FUNCTION(Take)
+    PROPERTY(Data)
+    NAMED_PROPERTY("SetData", GetData, SetData)
+REFLECTABLE_INIT()
+
+TEST(TestLibrary, TestMove)
+{
+    auto type = eightrefl::global()->find("TestMoveStruct");
+
+    ASSERT("type", type != nullptr);
+
+    auto reflection = type->reflection;
+
+    ASSERT("reflection", reflection != nullptr);
+
+    auto data = std::vector<int>{ 1, 2, 3 };
+
+    {
+        auto factory = reflection->factory.find("TestMoveStruct(std::vector<int>)");
+
+        ASSERT("factory", factory != nullptr && factory->raw_move_call != nullptr);
+
+        std::vector<std::any> arguments{ data };
+        auto object = factory->move_call(arguments);
+
+        EXPECT("factory-move_call", std::any_cast<TestMoveStruct&>(object).Data == data);
+        EXPECT("factory-move_call-released", std::any_cast<std::vector<int>&>(arguments[0]).empty());
+    }
+    {
+        auto take = reflection->function.find("Take")->find("int(std::vector<int>, int&)");
+
+        ASSERT("function", take != nullptr && take->raw_move_call != nullptr);
+
+        TestMoveStruct object;
+        int count = 0;
+
+        std::vector<std::any> arguments{ data, &count };
+        auto result = take->move_call(&object, arguments);
+
+        EXPECT("function-move_call", object.Data == data && count == 1 && std::any_cast<int>(result) == 1);
+        EXPECT("function-move_call-released", std::any_cast<std::vector<int>&>(arguments[0]).empty());
+
+        arguments[0] = data;
+        take->call(&object, arguments);
+
+        EXPECT("function-call-copied", std::any_cast<std::vector<int>&>(arguments[0]) == data && count == 2);
+    }
+    {
+        auto property = reflection->property.find("Data");
+
+        ASSERT("property", property != nullptr && property->raw_move_set != nullptr);
+
+        TestMoveStruct object;
+        std::any value = data;
+
+        property->move_set(&object, value);
+
+        EXPECT("property-move_set", object.Data == data);
+        EXPECT("property-move_set-released", std::any_cast<std::vector<int>&>(value).empty());
+    }
+    {
+        auto property = reflection->property.find("SetData");
+
+        ASSERT("property-setter", property != nullptr && property->raw_move_set != nullptr);
+
+        TestMoveStruct object;
+        std::any value = data;
+
+        property->move_set(&object, value);
+
+        EXPECT("property-setter-move_set", object.Data == data);
+        EXPECT("property-setter-move_set-released", std::any_cast<std::vector<int>&>(value).empty());
+    }
+}
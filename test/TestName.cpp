@@ -0,0 +1,96 @@
+#include <EightreflTestingBase.hpp>
+
+#include <string> // to_string
+#include <string_view> // string_view
+
+TEST_SPACE()
+{
+
+struct TestNameStruct
+{
+    int Get() const { return Value; }
+
+    int Value = 0;
+};
+
+} // TEST_SPACE
+
+REFLECTABLE_DECLARATION(TestNameStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestNameStruct)
+    FUNCTION(Get)
+    PROPERTY(Value)
+REFLECTABLE_INIT()
+
+TEST(TestLibrary::TestName, TestHashedName)
+{
+    static constexpr eightrefl::hashed_name_t name = "TestNameStruct";
+
+    static_assert(name.hash == eightrefl::hashed_name_t::hash_of("TestNameStruct"));
+    static_assert(name == eightrefl::hashed_name_t("TestNameStruct"));
+    static_assert(name != eightrefl::hashed_name_t("TestNameStructs"));
+
+    EXPECT("hash", eightrefl::hashed_name_t(std::string("TestNameStruct")).hash == name.hash);
+}
+
+TEST(TestLibrary::TestName, TestFind)
+{
+    static constexpr eightrefl::hashed_name_t name = "TestNameStruct";
+
+    auto type = eightrefl::global()->find(name);
+
+    ASSERT("type", type != nullptr && type->name == "TestNameStruct");
+
+    EXPECT("type-string", eightrefl::global()->find(std::string("TestNameStruct")) == type);
+    EXPECT("type-string_view", eightrefl::global()->find(std::string_view("TestNameStruct")) == type);
+    EXPECT("type-literal", eightrefl::global()->find("TestNameStruct") == type);
+    EXPECT("type-unknown", eightrefl::global()->find(std::string_view("TestNameStruct", 8)) == nullptr);
+
+    static constexpr eightrefl::hashed_name_t property_name = "Value";
+
+    auto property = type->reflection->property.find(property_name);
+
+    ASSERT("property", property != nullptr && property->name == "Value");
+
+    EXPECT("property-string_view", type->reflection->property.find(std::string_view("Value")) == property);
+    EXPECT("property-unknown", type->reflection->property.find("Values") == nullptr);
+
+    auto function = type->reflection->function.find(std::string_view("Get"));
+
+    ASSERT("function", function != nullptr);
+    EXPECT("function-overload", function->find("int() const") != nullptr);
+}
+
+TEST(TestLibrary::TestName, TestAtom)
+{
+    auto atom = eightrefl::intern("TestNameStruct::Atom");
+
+    EXPECT("atom", atom.id != 0 && atom.name() == "TestNameStruct::Atom");
+    EXPECT("atom-equal", eightrefl::intern(std::string("TestNameStruct::Atom")) == atom);
+    EXPECT("atom-not_equal", eightrefl::intern("TestNameStruct::Other") != atom);
+    EXPECT("atom-empty", eightrefl::intern("") == eightrefl::atom_t{} && eightrefl::atom_t{}.name().empty());
+
+    EXPECT("find_atom", eightrefl::find_atom("TestNameStruct::Atom") == atom);
+    EXPECT("find_atom-unknown", eightrefl::find_atom("TestNameStruct::Unknown") == eightrefl::atom_t{});
+
+    auto type = eightrefl::global()->find("TestNameStruct");
+
+    ASSERT("type", type != nullptr);
+    EXPECT("type-atom", type->atom == eightrefl::find_atom("TestNameStruct") && type->atom.name() == type->name);
+
+    auto key = eightrefl::global()->all.find("TestNameStruct");
+
+    ASSERT("key", key != eightrefl::global()->all.end());
+    EXPECT("key-interned", key->first.name.data() == type->atom.name().data());
+
+    auto property = type->reflection->property.all.find("Value");
+
+    ASSERT("property-key", property != type->reflection->property.all.end());
+    EXPECT("property-key-interned", property->first.name.data() == eightrefl::find_atom("Value").name().data());
+
+    auto text = atom.name().data();
+    for (int index = 0; index < 2048; ++index) eightrefl::intern("TestNameStruct::Atom" + std::to_string(index));
+
+    EXPECT("atom-stable", atom.name().data() == text);
+}
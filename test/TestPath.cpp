@@ -0,0 +1,168 @@
+#include <EightreflTestingBase.hpp>
+
+#include <Eightrefl/Path.hpp>
+
+TEST_SPACE()
+{
+
+struct TestPathVectorStruct
+{
+    float X = 0.f;
+    float Y = 0.f;
+};
+
+struct TestPathTransformStruct
+{
+    int Padding = 0;
+    TestPathVectorStruct Position;
+};
+
+struct TestPathNodeStruct
+{
+    TestPathTransformStruct& Reference() { return Transform; }
+    TestPathTransformStruct* Find() { return &Transform; }
+
+    double Padding = 0.;
+    TestPathTransformStruct Transform;
+    TestPathNodeStruct* Child = nullptr;
+};
+
+struct TestPathBaseStruct
+{
+    int Id = 0;
+};
+
+struct TestPathSceneStruct : TestPathVectorStruct, TestPathBaseStruct
+{
+    TestPathNodeStruct Root;
+};
+
+} // TEST_SPACE
+
+REFLECTABLE_DECLARATION(TestPathVectorStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestPathVectorStruct)
+    PROPERTY(X)
+    PROPERTY(Y)
+REFLECTABLE_INIT()
+
+REFLECTABLE_DECLARATION(TestPathTransformStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestPathTransformStruct)
+    PROPERTY(Position)
+REFLECTABLE_INIT()
+
+REFLECTABLE_DECLARATION(TestPathNodeStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestPathNodeStruct)
+    PROPERTY(Reference)
+    FUNCTION(Find)
+    PROPERTY(Transform)
+    PROPERTY(Child)
+REFLECTABLE_INIT()
+
+REFLECTABLE_DECLARATION(TestPathBaseStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestPathBaseStruct)
+    PROPERTY(Id)
+REFLECTABLE_INIT()
+
+REFLECTABLE_DECLARATION(TestPathSceneStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestPathSceneStruct)
+    PARENT(TestPathVectorStruct)
+    PARENT(TestPathBaseStruct)
+    PROPERTY(Root)
+REFLECTABLE_INIT()
+
+TEST(TestLibrary::TestPath, TestOffset)
+{
+    auto type = eightrefl::global()->find("TestPathTransformStruct");
+
+    ASSERT("type", type != nullptr);
+
+    auto position = type->reflection->property.find("Position");
+
+    ASSERT("property", position != nullptr);
+    EXPECT("property-offset", position->offset == offsetof(TestPathTransformStruct, Position));
+
+    auto node_type = eightrefl::global()->find("TestPathNodeStruct");
+
+    ASSERT("node_type", node_type != nullptr);
+    EXPECT("property-getter-offset", node_type->reflection->property.find("Reference")->offset == eightrefl::property_t::npos);
+}
+
+TEST(TestLibrary::TestPath, TestCompile)
+{
+    auto type = eightrefl::global()->find("TestPathSceneStruct");
+
+    ASSERT("type", type != nullptr);
+
+    auto node_type = eightrefl::global()->find("TestPathNodeStruct");
+
+    ASSERT("node_type", node_type != nullptr);
+
+    TestPathSceneStruct scene;
+    scene.Root.Transform.Position.Y = 2.f;
+
+    {
+        auto path = eightrefl::compile_path(node_type, "Transform.Position.Y");
+
+        ASSERT("data", path);
+        EXPECT("data-folded", path.steps.size() == 1 && path.steps.front().hop == nullptr);
+        EXPECT("data-context", path.context(&scene.Root) == &scene.Root.Transform.Position.Y);
+
+        float value = 0.f;
+
+        EXPECT("data-get", path.raw_get(&scene.Root, &value) && value == 2.f);
+
+        value = 3.f;
+
+        EXPECT("data-set", path.raw_set(&scene.Root, &value) && scene.Root.Transform.Position.Y == 3.f);
+    }
+    {
+        // scene is not standard-layout, so its members are reached by handlers
+        auto path = eightrefl::compile_path(type, "Root.Transform.Position.Y");
+
+        ASSERT("handler", path);
+        EXPECT("handler-not-folded", path.steps.size() > 1);
+        EXPECT("handler-context", path.context(&scene) == &scene.Root.Transform.Position.Y);
+    }
+    {
+        auto path = eightrefl::compile_path(type, "Root.Reference.Position.X");
+
+        ASSERT("getter", path);
+        EXPECT("getter-context", path.context(&scene) == &scene.Root.Transform.Position.X);
+    }
+    {
+        auto path = eightrefl::compile_path(type, "Root.Find.Position.X");
+
+        ASSERT("function", path);
+        EXPECT("function-context", path.context(&scene) == &scene.Root.Transform.Position.X);
+    }
+    {
+        auto path = eightrefl::compile_path(type, "Root.Child.Transform.Position");
+
+        ASSERT("pointer", path);
+        EXPECT("pointer-null", path.context(&scene) == nullptr);
+
+        TestPathNodeStruct child;
+        scene.Root.Child = &child;
+
+        EXPECT("pointer-context", path.context(&scene) == &child.Transform.Position);
+    }
+    {
+        auto path = eightrefl::compile_path(type, "Id");
+
+        ASSERT("parent", path);
+        EXPECT("parent-context", path.context(&scene) == &static_cast<TestPathBaseStruct&>(scene).Id);
+    }
+
+    EXPECT("unknown", !eightrefl::compile_path(type, "Root.Unknown"));
+    EXPECT("function-last", !eightrefl::compile_path(type, "Root.Find"));
+}
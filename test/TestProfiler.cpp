@@ -0,0 +1,71 @@
+#ifdef EIGHTREFL_PROFILER_ENABLE
+#include <EightreflTestingBase.hpp>
+
+#include <Eightrefl/Profiler.hpp>
+
+TEST_SPACE()
+{
+
+template <typename T>
+struct TestProfilerStruct
+{
+    T Get() const { return Value; }
+    void Set(T value) { Value = value; }
+
+    T Value = T();
+};
+
+} // TEST_SPACE
+
+TEMPLATE_REFLECTABLE_DECLARATION((template <typename T>), TestProfilerStruct<T>)
+    REFLECTABLE_NAME("TestProfilerStruct<" + eightrefl::name_of<T>() + ">")
+REFLECTABLE_DECLARATION_INIT()
+
+TEMPLATE_REFLECTABLE((template <typename T>), TestProfilerStruct<T>)
+    FUNCTION(Get)
+    FUNCTION(Set)
+    PROPERTY(Value)
+REFLECTABLE_INIT()
+
+TEST(TestLibrary::TestProfiler, TestType)
+{
+    eightrefl::reflectable<TestProfilerStruct<int>>();
+
+    auto profiles = eightrefl::profiler()->top(static_cast<std::size_t>(-1));
+
+    eightrefl::profile_t const* profile = nullptr;
+    for (auto const& item : profiles) if (item.name == "TestProfilerStruct<int>") profile = &item;
+
+    ASSERT("profile", profile != nullptr);
+
+    EXPECT("profile-registry", profile->registry == eightrefl::global());
+    EXPECT("profile-attribute", profile->attribute_count >= 4);
+    EXPECT("profile-allocation", profile->allocation_count > 0 && profile->allocation_size > 0);
+    EXPECT("profile-evaluation", profile->evaluation_count == 1);
+    EXPECT("profile-add_time", profile->add_time.count() > 0 && profile->add_time <= profile->time);
+
+    auto ordered = true;
+    for (std::size_t index = 1; index < profiles.size(); ++index)
+    {
+        ordered = ordered && profiles[index - 1].time >= profiles[index].time;
+    }
+
+    EXPECT("top-ordered", ordered);
+    EXPECT("top-count", eightrefl::profiler()->top(1).size() == 1);
+}
+
+TEST(TestLibrary::TestProfiler, TestReport)
+{
+    eightrefl::reflectable<TestProfilerStruct<float>>();
+
+    auto report = eightrefl::profiler()->report(static_cast<std::size_t>(-1));
+
+    EXPECT("report", report.find("TestProfilerStruct<float> [global]") != std::string::npos);
+
+    auto json = eightrefl::profiler()->report_json(static_cast<std::size_t>(-1));
+
+    EXPECT("report_json", json.find("\"name\":\"TestProfilerStruct<float>\"") != std::string::npos);
+    EXPECT("report_json-registry", json.find("\"name\":\"global\"") != std::string::npos);
+    EXPECT("report_json-add_time", json.find("\"add_time_ns\":") != std::string::npos);
+}
+#endif // EIGHTREFL_PROFILER_ENABLE
@@ -1,5 +1,7 @@
 #include <EightreflTestingBase.hpp>
 
+#include <Eightrefl/Standard/string.hpp>
+
 TEST_SPACE()
 {
 
@@ -213,3 +215,243 @@ TEST(TestLibrary::TestRegistryFunction, TestFreeFunction)
         EXPECT("function-template_with_args", reflection->function.find("Template<int, bool>") != nullptr);
     }
 }
+
+
+TEST_SPACE()
+{
+
+struct TestRawCallFunctionStruct
+{
+    int Sum(int lhs, int const& rhs) const { return Value + lhs + rhs; }
+    int& Reference() { return Value; }
+    void Assign(int* value) { Value = *value; }
+    int Length(std::string text) const { return static_cast<int>(text.size()); }
+
+    static int Twice(int value) { return 2 * value; }
+
+    int Value = 1;
+};
+
+} // TEST_SPACE
+
+REFLECTABLE_DECLARATION(TestRawCallFunctionStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestRawCallFunctionStruct)
+    FUNCTION(Sum)
+    FUNCTION(Reference)
+    FUNCTION(Assign)
+    FUNCTION(Length)
+    FUNCTION(Twice)
+REFLECTABLE_INIT()
+
+TEST(TestLibrary::TestRegistryFunction, TestRawCallFunction)
+{
+    auto type = eightrefl::global()->find("TestRawCallFunctionStruct");
+
+    ASSERT("type", type != nullptr);
+
+    auto reflection = type->reflection;
+
+    ASSERT("reflection", reflection != nullptr);
+
+    TestRawCallFunctionStruct object;
+
+    {
+        auto sum = reflection->function.find("Sum")->find("int(int, int const&) const");
+
+        ASSERT("function-sum", sum != nullptr && sum->raw_call != nullptr);
+
+        int lhs = 2, rhs = 3;
+        int* rhs_context = &rhs;
+
+        void* arguments[] = { &lhs, &rhs_context };
+        int result = 0;
+
+        sum->raw_call(&object, arguments, &result);
+
+        EXPECT("function-sum-result", result == 6);
+    }
+    {
+        auto reference = reflection->function.find("Reference")->find("int&()");
+
+        ASSERT("function-reference", reference != nullptr);
+
+        int* result = nullptr;
+
+        reference->raw_call(&object, nullptr, &result);
+
+        EXPECT("function-reference-result", result == &object.Value);
+    }
+    {
+        auto assign = reflection->function.find("Assign")->find("void(int*)");
+
+        ASSERT("function-assign", assign != nullptr);
+
+        int value = 7;
+        int* value_context = &value;
+
+        void* arguments[] = { &value_context };
+
+        assign->raw_call(&object, arguments, nullptr);
+
+        EXPECT("function-assign-result", object.Value == 7);
+    }
+    {
+        auto twice = reflection->function.find("Twice")->find("int(int)");
+
+        ASSERT("function-twice", twice != nullptr);
+
+        int value = 4;
+
+        void* arguments[] = { &value };
+        int result = 0;
+
+        twice->raw_call(nullptr, arguments, &result);
+
+        EXPECT("function-twice-result", result == 8);
+    }
+    {
+        auto length = reflection->function.find("Length")->find("int(std::string) const");
+
+        ASSERT("function-length", length != nullptr);
+
+        std::string text = "argument, that is long enough to be allocated";
+
+        void* arguments[] = { &text };
+        int lhs = 0, rhs = 0;
+
+        length->raw_call(&object, arguments, &lhs);
+        length->raw_call(&object, arguments, &rhs);
+
+        EXPECT("function-length-result", lhs == 45 && rhs == 45);
+        EXPECT("function-length-argument", text == "argument, that is long enough to be allocated");
+    }
+}
+
+TEST(TestLibrary::TestRegistryFunction, TestInvokerFunction)
+{
+    auto type = eightrefl::global()->find("TestRawCallFunctionStruct");
+
+    ASSERT("type", type != nullptr);
+
+    auto reflection = type->reflection;
+
+    ASSERT("reflection", reflection != nullptr);
+
+    TestRawCallFunctionStruct object;
+
+    {
+        auto sum = reflection->function.find("Sum")->find("int(int, int const&) const");
+
+        ASSERT("function-sum", sum != nullptr);
+
+        auto invoker = sum->as<int(TestRawCallFunctionStruct::*)(int, int const&) const>();
+
+        ASSERT("function-sum-invoker", invoker);
+        EXPECT("function-sum-invoker-reference", invoker(object, 2, 3) == 6);
+        EXPECT("function-sum-invoker-pointer", invoker(&object, 3, 4) == 8);
+
+        EXPECT("function-sum-invoker-mismatch", !sum->as<int(TestRawCallFunctionStruct::*)(int, int const&)>());
+        EXPECT("function-sum-invoker-free", !sum->as<int(int, int const&)>());
+    }
+    {
+        auto reference = reflection->function.find("Reference")->find("int&()");
+
+        ASSERT("function-reference", reference != nullptr);
+
+        auto invoker = reference->as<int&(TestRawCallFunctionStruct::*)()>();
+
+        ASSERT("function-reference-invoker", invoker);
+        EXPECT("function-reference-invoker-result", &invoker(object) == &object.Value);
+    }
+    {
+        auto twice = reflection->function.find("Twice")->find("int(int)");
+
+        ASSERT("function-twice", twice != nullptr);
+
+        auto invoker = twice->as<int(int)>();
+
+        ASSERT("function-twice-invoker", invoker);
+        EXPECT("function-twice-invoker-result", invoker(5) == 10);
+        EXPECT("function-twice-invoker-mismatch", !twice->as<int(float)>());
+    }
+}
+
+TEST(TestLibrary::TestRegistryFunction, TestBatchCallFunction)
+{
+    auto type = eightrefl::global()->find("TestRawCallFunctionStruct");
+
+    ASSERT("type", type != nullptr);
+
+    auto reflection = type->reflection;
+
+    ASSERT("reflection", reflection != nullptr);
+
+    TestRawCallFunctionStruct objects[3];
+    objects[1].Value = 2;
+    objects[2].Value = 3;
+
+    {
+        auto sum = reflection->function.find("Sum")->find("int(int, int const&) const");
+
+        ASSERT("function-sum", sum != nullptr && sum->raw_batch_call != nullptr);
+
+        int lhs = 10, rhs = 100;
+        int* rhs_context = &rhs;
+
+        void* arguments[] = { &lhs, &rhs_context };
+        int results[3] = {};
+
+        sum->raw_batch_call(eightrefl::batch_of(objects, 3), arguments, results);
+
+        EXPECT("function-sum-results", results[0] == 111 && results[1] == 112 && results[2] == 113);
+    }
+    {
+        auto reference = reflection->function.find("Reference")->find("int&()");
+
+        ASSERT("function-reference", reference != nullptr);
+
+        TestRawCallFunctionStruct* contexts[] = { &objects[2], &objects[0] };
+        int* results[2] = {};
+
+        reference->raw_batch_call(eightrefl::batch_of(contexts, 2), nullptr, results);
+
+        EXPECT("function-reference-results", results[0] == &objects[2].Value && results[1] == &objects[0].Value);
+    }
+    {
+        auto assign = reflection->function.find("Assign")->find("void(int*)");
+
+        ASSERT("function-assign", assign != nullptr);
+
+        int value = 7;
+        int* value_context = &value;
+
+        void* arguments[] = { &value_context };
+
+        assign->raw_batch_call(eightrefl::batch_of(objects, 3), arguments, nullptr);
+
+        EXPECT("function-assign-results", objects[0].Value == 7 && objects[1].Value == 7 && objects[2].Value == 7);
+    }
+    {
+        auto length = reflection->function.find("Length")->find("int(std::string) const");
+
+        ASSERT("function-length", length != nullptr && length->raw_batch_call != nullptr);
+
+        std::string text = "argument, that is long enough to be allocated";
+
+        void* arguments[] = { &text };
+        int results[3] = {};
+
+        length->raw_batch_call(eightrefl::batch_of(objects, 3), arguments, results);
+
+        EXPECT("function-length-results", results[0] == 45 && results[1] == 45 && results[2] == 45);
+        EXPECT("function-length-argument", text == "argument, that is long enough to be allocated");
+    }
+    {
+        auto twice = reflection->function.find("Twice")->find("int(int)");
+
+        ASSERT("function-twice", twice != nullptr);
+        EXPECT("function-twice-batch", twice->raw_batch_call == nullptr);
+    }
+}
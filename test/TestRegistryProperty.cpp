@@ -515,3 +515,197 @@ TEST(TestLibrary::TestRegistryProperty, TestFreeFunctionProperty)
         EXPECT("property-readonly_no_context-context", readonly_no_context->context == nullptr);
     }
 }
+
+
+TEST_SPACE()
+{
+
+struct TestBatchPropertyStruct
+{
+    int Value = 0;
+
+    int const& Accessor() const { return Value; } void Accessor(int const& value) { Value = value; }
+
+    static int Static;
+};
+
+int TestBatchPropertyStruct::Static = 0;
+
+} // TEST_SPACE
+
+REFLECTABLE_DECLARATION(TestBatchPropertyStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestBatchPropertyStruct)
+    PROPERTY(Value)
+    PROPERTY(Accessor)
+    PROPERTY(Static)
+REFLECTABLE_INIT()
+
+TEST(TestLibrary::TestRegistryProperty, TestBatchProperty)
+{
+    auto type = eightrefl::global()->find("TestBatchPropertyStruct");
+
+    ASSERT("type", type != nullptr);
+
+    auto reflection = type->reflection;
+
+    ASSERT("reflection", reflection != nullptr);
+
+    TestBatchPropertyStruct objects[3];
+    objects[0].Value = 1;
+    objects[1].Value = 2;
+    objects[2].Value = 3;
+
+    {
+        auto value = reflection->property.find("Value");
+
+        ASSERT("property-value", value != nullptr && value->raw_batch_get != nullptr && value->raw_batch_set != nullptr);
+
+        int results[3] = {};
+
+        value->raw_batch_get(eightrefl::batch_of(objects, 3), results);
+
+        EXPECT("property-value-get", results[0] == 1 && results[1] == 2 && results[2] == 3);
+
+        int shared = 5;
+
+        value->raw_batch_set(eightrefl::batch_of(objects, 2), &shared);
+
+        EXPECT("property-value-set", objects[0].Value == 5 && objects[1].Value == 5 && objects[2].Value == 3);
+    }
+    {
+        auto accessor = reflection->property.find("Accessor");
+
+        ASSERT("property-accessor", accessor != nullptr && accessor->raw_batch_set != nullptr);
+
+        TestBatchPropertyStruct* contexts[] = { &objects[2], &objects[0] };
+
+        int shared = 9;
+        int* shared_context = &shared;
+
+        accessor->raw_batch_set(eightrefl::batch_of(contexts, 2), &shared_context);
+
+        EXPECT("property-accessor-set", objects[0].Value == 9 && objects[1].Value == 5 && objects[2].Value == 9);
+
+        int* results[2] = {};
+
+        accessor->raw_batch_get(eightrefl::batch_of(contexts, 2), results);
+
+        EXPECT("property-accessor-get", results[0] == &objects[2].Value && results[1] == &objects[0].Value);
+    }
+    {
+        auto static_property = reflection->property.find("Static");
+
+        ASSERT("property-static", static_property != nullptr);
+        EXPECT("property-static-get", static_property->raw_batch_get == nullptr);
+        EXPECT("property-static-set", static_property->raw_batch_set == nullptr);
+    }
+}
+
+
+TEST_SPACE()
+{
+
+struct TestLayoutPropertyInnerStruct
+{
+    TestLayoutPropertyInnerStruct() = default;
+    TestLayoutPropertyInnerStruct(TestLayoutPropertyInnerStruct const&) {}
+    TestLayoutPropertyInnerStruct& operator=(TestLayoutPropertyInnerStruct const&) = default;
+};
+
+struct TestLayoutPropertyStruct
+{
+    char Char = 0;
+    double Double = 0.;
+    TestLayoutPropertyInnerStruct Inner;
+
+    int Getter() const { return 0; }
+};
+
+struct TestLayoutPropertyVirtualStruct
+{
+    virtual ~TestLayoutPropertyVirtualStruct() = default;
+
+    int Value = 0;
+};
+
+} // TEST_SPACE
+
+REFLECTABLE_DECLARATION(TestLayoutPropertyInnerStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestLayoutPropertyInnerStruct)
+REFLECTABLE_INIT()
+
+REFLECTABLE_DECLARATION(TestLayoutPropertyStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestLayoutPropertyStruct)
+    PROPERTY(Char)
+    PROPERTY(Double)
+    PROPERTY(Inner)
+    PROPERTY(Getter)
+REFLECTABLE_INIT()
+
+REFLECTABLE_DECLARATION(TestLayoutPropertyVirtualStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestLayoutPropertyVirtualStruct)
+    PROPERTY(Value)
+REFLECTABLE_INIT()
+
+TEST(TestLibrary::TestRegistryProperty, TestLayoutProperty)
+{
+    auto type = eightrefl::global()->find("TestLayoutPropertyStruct");
+
+    ASSERT("type", type != nullptr);
+
+    auto reflection = type->reflection;
+
+    ASSERT("reflection", reflection != nullptr);
+
+    {
+        auto property = reflection->property.find("Double");
+
+        ASSERT("property-double", property != nullptr);
+        EXPECT("property-double-offset", property->offset == offsetof(TestLayoutPropertyStruct, Double));
+        EXPECT("property-double-size", property->size == sizeof(double));
+        EXPECT("property-double-alignment", property->alignment == alignof(double));
+        EXPECT("property-double-plain", property->plain);
+    }
+    {
+        auto property = reflection->property.find("Char");
+
+        ASSERT("property-char", property != nullptr);
+        EXPECT("property-char-offset", property->offset == offsetof(TestLayoutPropertyStruct, Char));
+        EXPECT("property-char-size", property->size == sizeof(char));
+        EXPECT("property-char-plain", property->plain);
+    }
+    {
+        auto property = reflection->property.find("Inner");
+
+        ASSERT("property-inner", property != nullptr);
+        EXPECT("property-inner-offset", property->offset == offsetof(TestLayoutPropertyStruct, Inner));
+        EXPECT("property-inner-plain", !property->plain);
+    }
+    {
+        auto property = reflection->property.find("Getter");
+
+        ASSERT("property-getter", property != nullptr);
+        EXPECT("property-getter-offset", property->offset == eightrefl::property_t::npos);
+        EXPECT("property-getter-size", property->size == 0);
+        EXPECT("property-getter-plain", !property->plain);
+    }
+    {
+        auto virtual_type = eightrefl::global()->find("TestLayoutPropertyVirtualStruct");
+
+        ASSERT("virtual-type", virtual_type != nullptr);
+
+        auto property = virtual_type->reflection->property.find("Value");
+
+        ASSERT("property-virtual", property != nullptr);
+        EXPECT("property-virtual-offset", property->offset == eightrefl::property_t::npos);
+        EXPECT("property-virtual-size", property->size == sizeof(int));
+    }
+}
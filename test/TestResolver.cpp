@@ -0,0 +1,152 @@
+#include <EightreflTestingBase.hpp>
+
+#include <Eightrefl/Resolver.hpp>
+
+TEST_SPACE()
+{
+
+struct TestResolverBaseStruct {};
+struct TestResolverDerivedStruct : TestResolverBaseStruct {};
+struct TestResolverMostDerivedStruct : TestResolverDerivedStruct {};
+
+struct TestResolverStruct
+{
+    int Number(int) { return 0; }
+    int Number(double) { return 1; }
+
+    int Bind(int&) { return 0; }
+    int Point(int*) { return 0; }
+
+    int Object(TestResolverBaseStruct const&) { return 0; }
+    int Object(TestResolverDerivedStruct const&) { return 1; }
+
+    int Mixed(int, double) { return 0; }
+    int Mixed(double, int) { return 1; }
+};
+
+} // TEST_SPACE
+
+REFLECTABLE_DECLARATION(TestResolverBaseStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestResolverBaseStruct)
+REFLECTABLE_INIT()
+
+REFLECTABLE_DECLARATION(TestResolverDerivedStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestResolverDerivedStruct)
+    PARENT(TestResolverBaseStruct)
+REFLECTABLE_INIT()
+
+REFLECTABLE_DECLARATION(TestResolverMostDerivedStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestResolverMostDerivedStruct)
+    PARENT(TestResolverDerivedStruct)
+REFLECTABLE_INIT()
+
+REFLECTABLE_DECLARATION(TestResolverStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestResolverStruct)
+    FUNCTION(Number, int(int))
+    FUNCTION(Number, int(double))
+    FUNCTION(Bind)
+    FUNCTION(Point)
+    FUNCTION(Object, int(TestResolverBaseStruct const&))
+    FUNCTION(Object, int(TestResolverDerivedStruct const&))
+    FUNCTION(Mixed, int(int, double))
+    FUNCTION(Mixed, int(double, int))
+REFLECTABLE_INIT()
+
+TEST(TestLibrary::TestResolver, TestRank)
+{
+    using eightrefl::resolver_t;
+    using eightrefl::type_of;
+
+    EXPECT("exact", resolver_t::rank(type_of<int>(), type_of<int>()) == resolver_t::exact);
+    EXPECT("adjust-bind", resolver_t::rank(type_of<int&>(), type_of<int>()) == resolver_t::adjust);
+    EXPECT("adjust-load", resolver_t::rank(type_of<int>(), type_of<int*>()) == resolver_t::adjust);
+    EXPECT("promotion-integral", resolver_t::rank(type_of<int>(), type_of<short>()) == resolver_t::promotion);
+    EXPECT("promotion-floating", resolver_t::rank(type_of<double>(), type_of<float>()) == resolver_t::promotion);
+    EXPECT("conversion", resolver_t::rank(type_of<float>(), type_of<long>()) == resolver_t::conversion);
+    EXPECT("conversion-void", resolver_t::rank(type_of<void*>(), type_of<int*>()) == resolver_t::conversion);
+
+    EXPECT("derived",
+           resolver_t::rank(type_of<TestResolverBaseStruct const&>(), type_of<TestResolverDerivedStruct>())
+           == resolver_t::derived + 1);
+    EXPECT("derived-pointer",
+           resolver_t::rank(type_of<TestResolverBaseStruct*>(), type_of<TestResolverMostDerivedStruct*>())
+           == resolver_t::derived + 2);
+
+    EXPECT("none", resolver_t::rank(type_of<TestResolverDerivedStruct>(), type_of<TestResolverBaseStruct>()) == resolver_t::npos);
+    EXPECT("none-arithmetic", resolver_t::rank(type_of<int*>(), type_of<double>()) == resolver_t::npos);
+
+    EXPECT("pointer-exact", resolver_t::rank(type_of<int*>(), type_of<int*>(), true) == resolver_t::exact);
+    EXPECT("pointer-none-object", resolver_t::rank(type_of<int*>(), type_of<int>(), true) == resolver_t::npos);
+    EXPECT("pointer-none-derived",
+           resolver_t::rank(type_of<TestResolverBaseStruct*>(), type_of<TestResolverDerivedStruct>(), true)
+           == resolver_t::npos);
+    EXPECT("pointer-derived",
+           resolver_t::rank(type_of<TestResolverBaseStruct*>(), type_of<TestResolverDerivedStruct*>(), true)
+           == resolver_t::derived + 1);
+}
+
+TEST(TestLibrary::TestResolver, TestResolve)
+{
+    using eightrefl::type_of;
+
+    auto type = eightrefl::global()->find("TestResolverStruct");
+
+    ASSERT("type", type != nullptr);
+
+    auto reflection = type->reflection;
+
+    ASSERT("reflection", reflection != nullptr);
+
+    eightrefl::resolver_t resolver;
+
+    {
+        auto number = reflection->function.find("Number");
+
+        ASSERT("function-number", number != nullptr);
+
+        EXPECT("function-number-exact", resolver.resolve(reflection, "Number", { type_of<int>() }) == number->find("int(int)"));
+        EXPECT("function-number-promotion", resolver.resolve(reflection, "Number", { type_of<float>() }) == number->find("int(double)"));
+        EXPECT("function-number-ambiguous", resolver.resolve(reflection, "Number", { type_of<long>() }) == nullptr);
+        EXPECT("function-number-none", resolver.resolve(reflection, "Number", { type_of<int*>(), type_of<int>() }) == nullptr);
+        EXPECT("function-number-cache", resolver.resolve(reflection, "Number", { type_of<float>() }) == number->find("int(double)"));
+    }
+    {
+        auto bind = reflection->function.find("Bind");
+
+        ASSERT("function-bind", bind != nullptr);
+        EXPECT("function-bind-adjust", resolver.resolve(reflection, "Bind", { type_of<int>() }) == bind->find("int(int&)"));
+    }
+    {
+        auto point = reflection->function.find("Point");
+
+        ASSERT("function-point", point != nullptr);
+        EXPECT("function-point-exact", resolver.resolve(reflection, "Point", { type_of<int*>() }) == point->find("int(int*)"));
+        EXPECT("function-point-none", resolver.resolve(reflection, "Point", { type_of<int>() }) == nullptr);
+    }
+    {
+        auto object = reflection->function.find("Object");
+
+        ASSERT("function-object", object != nullptr);
+
+        EXPECT("function-object-exact",
+               resolver.resolve(reflection, "Object", { type_of<TestResolverBaseStruct>() })
+               == object->find("int(TestResolverBaseStruct const&)"));
+        EXPECT("function-object-nearest",
+               resolver.resolve(reflection, "Object", { type_of<TestResolverMostDerivedStruct>() })
+               == object->find("int(TestResolverDerivedStruct const&)"));
+    }
+    {
+        EXPECT("function-mixed-exact", resolver.resolve(reflection, "Mixed", { type_of<int>(), type_of<double>() }) != nullptr);
+        EXPECT("function-mixed-ambiguous", resolver.resolve(reflection, "Mixed", { type_of<int>(), type_of<int>() }) == nullptr);
+    }
+
+    EXPECT("function-unknown", resolver.resolve(reflection, "Unknown", { type_of<int>() }) == nullptr);
+}
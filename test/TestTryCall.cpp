@@ -0,0 +1,162 @@
+#include <EightreflTestingBase.hpp>
+
+TEST_SPACE()
+{
+
+struct TestTryCallStruct
+{
+    TestTryCallStruct() = default;
+    TestTryCallStruct(int value) : Value(value) {}
+
+    int Sum(int lhs, int const& rhs) const { return Value + lhs + rhs; }
+
+    static int Twice(int value) { return 2 * value; }
+
+    int Value = 0;
+    int const Constant = 0;
+};
+
+} // TEST_SPACE
+
+REFLECTABLE_DECLARATION(TestTryCallStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestTryCallStruct)
+    FACTORY(R(int))
+    FUNCTION(Sum)
+    FUNCTION(Twice)
+    PROPERTY(Value)
+    PROPERTY(Constant)
+REFLECTABLE_INIT()
+
+TEST(TestLibrary::TestTryCall, TestFunction)
+{
+    using eightrefl::call_status_t;
+
+    auto type = eightrefl::global()->find("TestTryCallStruct");
+
+    ASSERT("type", type != nullptr);
+
+    auto reflection = type->reflection;
+
+    ASSERT("reflection", reflection != nullptr);
+
+    TestTryCallStruct object(1);
+
+    {
+        auto sum = reflection->function.find("Sum")->find("int(int, int const&) const");
+
+        ASSERT("function-sum", sum != nullptr && sum->raw_call != nullptr);
+
+        int rhs = 100;
+        std::any result;
+
+        EXPECT("function-sum-success",
+               sum->try_call(&object, { 10, &rhs }, result) == call_status_t::success && std::any_cast<int>(result) == 111);
+
+        EXPECT("function-sum-context", sum->try_call(&rhs, { 10, &rhs }, result) == call_status_t::context_mismatch);
+        EXPECT("function-sum-count", sum->try_call(&object, { 10 }, result) == call_status_t::argument_count_mismatch);
+        EXPECT("function-sum-type", sum->try_call(&object, { 10, rhs }, result) == call_status_t::argument_type_mismatch);
+        EXPECT("function-sum-type-value", sum->try_call(&object, { 10.f, &rhs }, result) == call_status_t::argument_type_mismatch);
+    }
+    {
+        auto twice = reflection->function.find("Twice")->find("int(int)");
+
+        ASSERT("function-twice", twice != nullptr && twice->raw_call != nullptr);
+
+        std::any result;
+
+        EXPECT("function-twice-success", twice->try_call({}, { 4 }, result) == call_status_t::success && std::any_cast<int>(result) == 8);
+        EXPECT("function-twice-type", twice->try_call({}, { 4u }, result) == call_status_t::argument_type_mismatch);
+    }
+    {
+        auto sum = reflection->function.find("Sum")->find("int(int, int const&) const");
+
+        int lhs = 10, rhs = 100;
+        int* rhs_context = &rhs;
+
+        void* arguments[] = { &lhs, &rhs_context };
+        int result = 0;
+
+        EXPECT("function-sum-raw-success",
+               sum->try_raw_call(&object, sum->arguments, arguments, &result) == call_status_t::success && result == 111);
+
+        EXPECT("function-sum-raw-count",
+               sum->try_raw_call(&object, { sum->arguments[0] }, arguments, &result) == call_status_t::argument_count_mismatch);
+
+        EXPECT("function-sum-raw-type",
+               sum->try_raw_call(&object, { sum->arguments[0], sum->arguments[0] }, arguments, &result)
+               == call_status_t::argument_type_mismatch);
+    }
+}
+
+TEST(TestLibrary::TestTryCall, TestFactory)
+{
+    using eightrefl::call_status_t;
+
+    auto type = eightrefl::global()->find("TestTryCallStruct");
+
+    ASSERT("type", type != nullptr);
+
+    auto factory = type->reflection->factory.find("TestTryCallStruct(int)");
+
+    ASSERT("factory", factory != nullptr && factory->raw_call != nullptr);
+
+    std::any result;
+
+    EXPECT("factory-success",
+           factory->try_call({ 7 }, result) == call_status_t::success && std::any_cast<TestTryCallStruct&>(result).Value == 7);
+
+    EXPECT("factory-count", factory->try_call({}, result) == call_status_t::argument_count_mismatch);
+    EXPECT("factory-type", factory->try_call({ 7. }, result) == call_status_t::argument_type_mismatch);
+
+    int value = 3;
+    void* arguments[] = { &value };
+
+    alignas(TestTryCallStruct) unsigned char storage[sizeof(TestTryCallStruct)];
+
+    EXPECT("factory-raw-success", factory->try_raw_call(factory->arguments, arguments, storage) == call_status_t::success);
+    EXPECT("factory-raw-type", factory->try_raw_call({ type }, arguments, storage) == call_status_t::argument_type_mismatch);
+}
+
+TEST(TestLibrary::TestTryCall, TestProperty)
+{
+    using eightrefl::call_status_t;
+
+    auto type = eightrefl::global()->find("TestTryCallStruct");
+
+    ASSERT("type", type != nullptr);
+
+    auto reflection = type->reflection;
+
+    ASSERT("reflection", reflection != nullptr);
+
+    TestTryCallStruct object;
+
+    {
+        auto property = reflection->property.find("Value");
+
+        ASSERT("property", property != nullptr && property->raw_set != nullptr);
+
+        EXPECT("property-success", property->try_set(&object, 5) == call_status_t::success && object.Value == 5);
+        EXPECT("property-context", property->try_set(object, 6) == call_status_t::context_mismatch);
+        EXPECT("property-type", property->try_set(&object, 6.f) == call_status_t::argument_type_mismatch && object.Value == 5);
+
+        int value = 8;
+
+        EXPECT("property-raw-success",
+               property->try_raw_set(&object, property->type, &value) == call_status_t::success && object.Value == 8);
+
+        EXPECT("property-raw-type", property->try_raw_set(&object, type, &value) == call_status_t::argument_type_mismatch);
+    }
+    {
+        auto property = reflection->property.find("Constant");
+
+        ASSERT("property-constant", property != nullptr);
+        EXPECT("property-constant-try_set", property->try_set(&object, 8) == call_status_t::not_callable);
+
+        int value = 8;
+
+        EXPECT("property-constant-raw", property->try_raw_set(&object, property->type, &value) == call_status_t::not_callable);
+    }
+}
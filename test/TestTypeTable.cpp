@@ -0,0 +1,63 @@
+#include <EightreflTestingBase.hpp>
+
+#include <Eightrefl/TypeTable.hpp>
+
+#include <Eightrefl/Standard/string.hpp>
+
+#include <set> // set
+
+TEST_SPACE()
+{
+
+struct TestTypeTableStruct {};
+
+} // TEST_SPACE
+
+REFLECTABLE_DECLARATION(TestTypeTableStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestTypeTableStruct)
+REFLECTABLE_INIT()
+
+TEST(TestLibrary::TestTypeTable, TestId)
+{
+    auto type = eightrefl::global()->find("TestTypeTableStruct");
+    auto int_type = eightrefl::builtin()->find("int");
+    auto string_type = eightrefl::standard()->find("std::string");
+
+    ASSERT("type", type != nullptr && int_type != nullptr && string_type != nullptr);
+
+    std::set<std::size_t> ids = { type->id, int_type->id, string_type->id };
+
+    EXPECT("id-unique", ids.size() == 3);
+    EXPECT("id-dense", type->id < eightrefl::type_id_count() && string_type->id < eightrefl::type_id_count());
+
+    eightrefl::registry_t registry;
+
+    auto count = eightrefl::type_id_count();
+    auto local_type = registry.add<int>("int");
+
+    EXPECT("id-next", local_type->id == count && eightrefl::type_id_count() == count + 1);
+}
+
+TEST(TestLibrary::TestTypeTable, TestTable)
+{
+    auto type = eightrefl::global()->find("TestTypeTableStruct");
+    auto int_type = eightrefl::builtin()->find("int");
+
+    ASSERT("type", type != nullptr && int_type != nullptr);
+
+    eightrefl::type_table_t<std::string> table;
+
+    EXPECT("find-empty", table.find(type) == nullptr);
+
+    table.add(type, "struct");
+    table[int_type] = "int";
+
+    EXPECT("find", table.find(type) != nullptr && *table.find(type) == "struct");
+    EXPECT("subscript", table[int_type] == "int");
+
+    table.remove(type);
+
+    EXPECT("remove", table.find(type) == nullptr && table.find(int_type) != nullptr);
+}
@@ -0,0 +1,196 @@
+#include <EightreflTestingBase.hpp>
+
+#include <Eightrefl/Value.hpp>
+
+#include <Eightrefl/Standard/string.hpp>
+#include <Eightrefl/Standard/unique_ptr.hpp>
+
+TEST_SPACE()
+{
+
+struct TestValueBaseStruct
+{
+    int Base = 1;
+};
+
+struct TestValueStruct : TestValueBaseStruct
+{
+    TestValueStruct() = default;
+    TestValueStruct(std::string const& name) : Name(name) {}
+
+    std::string Greet(std::string const& other) const { return Name + ", " + other; }
+
+    std::string Name = "value";
+};
+
+struct TestValueHugeStruct
+{
+    char Data[256] = {};
+};
+
+} // TEST_SPACE
+
+REFLECTABLE_DECLARATION(TestValueBaseStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestValueBaseStruct)
+REFLECTABLE_INIT()
+
+REFLECTABLE_DECLARATION(TestValueStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestValueStruct)
+    PARENT(TestValueBaseStruct)
+    FACTORY(R(std::string const&))
+    FUNCTION(Greet)
+    PROPERTY(Name)
+REFLECTABLE_INIT()
+
+REFLECTABLE_DECLARATION(TestValueHugeStruct)
+REFLECTABLE_DECLARATION_INIT()
+
+REFLECTABLE(TestValueHugeStruct)
+REFLECTABLE_INIT()
+
+TEST(TestLibrary::TestValue, TestStorage)
+{
+    eightrefl::value_t value;
+
+    EXPECT("empty", !value.has_value() && value.type() == nullptr && value.data() == nullptr);
+
+    value.emplace<int>(123);
+
+    ASSERT("int", value.cast<int>() != nullptr);
+    EXPECT("int-type", value.type() == eightrefl::type_of<int>());
+    EXPECT("int-value", *value.cast<int>() == 123);
+    EXPECT("int-inline", value.is_inline());
+    EXPECT("int-cast", value.cast<float>() == nullptr);
+
+    value.emplace<std::string>("text");
+
+    ASSERT("string", value.cast<std::string>() != nullptr);
+    EXPECT("string-value", *value.cast<std::string>() == "text");
+
+    if (sizeof(std::string) <= eightrefl::value_t::capacity)
+    {
+        EXPECT("string-inline", value.is_inline());
+    }
+
+    auto copy = value;
+
+    ASSERT("copy", copy.cast<std::string>() != nullptr);
+    EXPECT("copy-value", *copy.cast<std::string>() == "text");
+    EXPECT("copy-storage", copy.data() != value.data());
+
+    auto move = std::move(copy);
+
+    ASSERT("move", move.cast<std::string>() != nullptr);
+    EXPECT("move-value", *move.cast<std::string>() == "text");
+    EXPECT("move-source", !copy.has_value());
+
+    value.emplace<TestValueHugeStruct>();
+
+    ASSERT("huge", value.cast<TestValueHugeStruct>() != nullptr);
+    EXPECT("huge-heap", !value.is_inline());
+
+    auto data = value.data();
+    auto huge_move = std::move(value);
+
+    EXPECT("huge-move", huge_move.data() == data && !value.has_value());
+
+    huge_move.reset();
+
+    EXPECT("reset", !huge_move.has_value());
+
+    eightrefl::value_t unique;
+    unique.emplace<std::unique_ptr<int>>(new int(1));
+
+    auto thrown = false;
+    try { auto unique_copy = unique; }
+    catch (std::logic_error const&) { thrown = true; }
+
+    EXPECT("copy-not-copyable", thrown && unique.cast<std::unique_ptr<int>>() != nullptr);
+
+    eightrefl::value_t assigned;
+    assigned.emplace<int>(7);
+
+    thrown = false;
+    try { assigned = unique; }
+    catch (std::logic_error const&) { thrown = true; }
+
+    EXPECT("copy-assign-not-copyable", thrown && assigned.cast<int>() != nullptr && *assigned.cast<int>() == 7);
+    EXPECT("move-noexcept", std::is_nothrow_move_constructible_v<eightrefl::value_t> && std::is_nothrow_move_assignable_v<eightrefl::value_t>);
+}
+
+TEST(TestLibrary::TestValue, TestHandlers)
+{
+    auto type = eightrefl::global()->find("TestValueStruct");
+
+    ASSERT("type", type != nullptr);
+
+    auto reflection = type->reflection;
+
+    ASSERT("reflection", reflection != nullptr);
+
+    eightrefl::value_t object;
+
+    {
+        auto factory = reflection->factory.find("TestValueStruct(std::string const&)");
+
+        ASSERT("factory", factory != nullptr && factory->raw_call != nullptr);
+
+        std::string name = "object";
+        std::string* name_context = &name;
+
+        void* arguments[] = { &name_context };
+
+        object.emplace(factory->result, [&](void* storage) { factory->raw_call(arguments, storage); });
+
+        ASSERT("factory-object", object.cast<TestValueStruct>() != nullptr);
+        EXPECT("factory-object-value", object.cast<TestValueStruct>()->Name == "object");
+    }
+    {
+        auto function = reflection->function.find("Greet")->find("std::string(std::string const&) const");
+
+        ASSERT("function", function != nullptr && function->raw_call != nullptr);
+
+        eightrefl::value_t argument;
+        argument.emplace<std::string*>(new std::string("world"));
+
+        void* arguments[] = { argument.data() };
+
+        eightrefl::value_t result;
+        result.emplace(function->result, [&](void* storage) { function->raw_call(object.data(), arguments, storage); });
+
+        delete *argument.cast<std::string*>();
+
+        ASSERT("function-result", result.cast<std::string>() != nullptr);
+        EXPECT("function-result-value", *result.cast<std::string>() == "object, world");
+    }
+    {
+        auto property = reflection->property.find("Name");
+
+        ASSERT("property", property != nullptr && property->raw_get != nullptr && property->raw_set != nullptr);
+
+        eightrefl::value_t value;
+        value.emplace<std::string>("renamed");
+
+        property->raw_set(object.data(), value.data());
+
+        eightrefl::value_t result;
+        result.emplace(property->type, [&](void* storage) { property->raw_get(object.data(), storage); });
+
+        ASSERT("property-result", result.cast<std::string>() != nullptr);
+        EXPECT("property-result-value", *result.cast<std::string>() == "renamed");
+        EXPECT("property-context", property->raw_context(object.data()) == &object.cast<TestValueStruct>()->Name);
+    }
+    {
+        auto parent = reflection->parent.find("TestValueBaseStruct");
+
+        ASSERT("parent", parent != nullptr && parent->raw_cast != nullptr);
+
+        auto base = static_cast<TestValueBaseStruct*>(parent->raw_cast(object.data()));
+
+        EXPECT("parent-cast", base == static_cast<TestValueBaseStruct*>(object.cast<TestValueStruct>()));
+    }
+}